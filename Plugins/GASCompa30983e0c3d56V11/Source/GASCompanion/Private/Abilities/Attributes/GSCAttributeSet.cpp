@@ -38,26 +38,40 @@ void UGSCAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbac
 
 	GSC_WLOG(VeryVerbose, TEXT("PostGameplayEffectExecute called for %s.%s"), *GetName(), *Data.EvaluatedData.Attribute.AttributeName)
 
+	const FGameplayAttribute& Attribute = Data.EvaluatedData.Attribute;
+
+	// Execution data is only built for attributes handled below
+	const bool bHandledAttribute = Attribute == GetDamageAttribute()
+		|| Attribute == GetStaminaDamageAttribute()
+		|| Attribute == GetHealthAttribute()
+		|| Attribute == GetStaminaAttribute()
+		|| Attribute == GetManaAttribute();
+
+	if (!bHandledAttribute)
+	{
+		return;
+	}
+
 	FGSCAttributeSetExecutionData ExecutionData;
 	GetExecutionDataFromMod(Data, ExecutionData);
 
-    if (Data.EvaluatedData.Attribute == GetDamageAttribute())
+    if (Attribute == GetDamageAttribute())
     {
     	HandleDamageAttribute(ExecutionData);
     }
-	else if (Data.EvaluatedData.Attribute == GetStaminaDamageAttribute())
+	else if (Attribute == GetStaminaDamageAttribute())
 	{
 		HandleStaminaDamageAttribute(ExecutionData);
 	}
-    else if (Data.EvaluatedData.Attribute == GetHealthAttribute())
+    else if (Attribute == GetHealthAttribute())
     {
     	HandleHealthAttribute(ExecutionData);
     }
-    else if (Data.EvaluatedData.Attribute == GetStaminaAttribute())
+    else if (Attribute == GetStaminaAttribute())
     {
     	HandleStaminaAttribute(ExecutionData);
     }
-    else if (Data.EvaluatedData.Attribute == GetManaAttribute())
+    else if (Attribute == GetManaAttribute())
     {
     	HandleManaAttribute(ExecutionData);
     }
@@ -144,7 +158,7 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 	AActor* SourceActor = ExecutionData.SourceActor;
 	AActor* TargetActor = ExecutionData.TargetActor;
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+	const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of Damage done and clear the Damage attribute.
 	const float LocalDamageDone = GetDamage();
@@ -184,7 +198,7 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 void UGSCAttributeSet::HandleStaminaDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData)
 {
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+	const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of damage done and clear the damage attribute
 	const float LocalStaminaDamageDone = GetStaminaDamage();
@@ -213,7 +227,7 @@ void UGSCAttributeSet::HandleHealthAttribute(const FGSCAttributeSetExecutionData
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleHealthChange(DeltaValue, SourceTags);
 	}
 }
@@ -228,7 +242,7 @@ void UGSCAttributeSet::HandleStaminaAttribute(const FGSCAttributeSetExecutionDat
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleStaminaChange(DeltaValue, SourceTags);
 	}
 }
@@ -243,7 +257,7 @@ void UGSCAttributeSet::HandleManaAttribute(const FGSCAttributeSetExecutionData&
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleManaChange(DeltaValue, SourceTags);
 	}
 }
@@ -31,8 +31,7 @@ void UGSCAttributeSetBase::PreAttributeChange(const FGameplayAttribute& Attribut
 		return;
 	}
 
-    const AActor* AvatarActor = AvatarActorPtr.Get();
-    UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor);
+    UGSCCoreComponent* CoreComponent = GetOwnerCoreComponent(AvatarActorPtr.Get());
     if (CoreComponent)
     {
         CoreComponent->PreAttributeChange(this, Attribute, NewValue);
@@ -43,11 +42,8 @@ void UGSCAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCal
 {
     Super::PostGameplayEffectExecute(Data);
 
-    AActor* SourceActor = nullptr;
-    AActor* TargetActor = nullptr;
-    GetSourceAndTargetFromContext<AActor>(Data, SourceActor, TargetActor);
-
-    UGSCCoreComponent* TargetCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(TargetActor);
+    const AActor* TargetActor = Data.Target.AbilityActorInfo.IsValid() ? Data.Target.AbilityActorInfo->AvatarActor.Get() : nullptr;
+    UGSCCoreComponent* TargetCoreComponent = GetOwnerCoreComponent(TargetActor);
     if (TargetCoreComponent)
     {
         TargetCoreComponent->PostGameplayEffectExecute(this, Data);
@@ -95,6 +91,51 @@ void UGSCAttributeSetBase::AdjustAttributeForMaxChange(FGameplayAttributeData& A
     }
 }
 
+void UGSCAttributeSetBase::SetOwnerCoreComponent(UGSCCoreComponent* InCoreComponent)
+{
+	CachedOwnerCoreComponent.Actor = InCoreComponent ? InCoreComponent->GetOwner() : nullptr;
+	CachedOwnerCoreComponent.CoreComponent = InCoreComponent;
+}
+
+UGSCCoreComponent* UGSCAttributeSetBase::GetOwnerCoreComponent(const AActor* AvatarActor)
+{
+	if (!AvatarActor)
+	{
+		return nullptr;
+	}
+
+	// Resolved for another avatar (or not at all), look it up again. A missing core component is cached as well.
+	if (CachedOwnerCoreComponent.Actor.Get() != AvatarActor)
+	{
+		CachedOwnerCoreComponent.Actor = AvatarActor;
+		CachedOwnerCoreComponent.CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor);
+	}
+
+	return CachedOwnerCoreComponent.CoreComponent.Get();
+}
+
+UGSCCoreComponent* UGSCAttributeSetBase::GetSourceCoreComponent(const AActor* SourceActor)
+{
+	if (!SourceActor)
+	{
+		return nullptr;
+	}
+
+	if (CachedSourceCoreComponent.Actor.Get() == SourceActor)
+	{
+		if (UGSCCoreComponent* CoreComponent = CachedSourceCoreComponent.CoreComponent.Get())
+		{
+			return CoreComponent;
+		}
+	}
+
+	// Only found core components are cached, as nothing tells this set when one is added to another actor
+	UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(SourceActor);
+	CachedSourceCoreComponent.Actor = CoreComponent ? SourceActor : nullptr;
+	CachedSourceCoreComponent.CoreComponent = CoreComponent;
+	return CoreComponent;
+}
+
 void UGSCAttributeSetBase::GetExecutionDataFromMod(const FGameplayEffectModCallbackData& Data, FGSCAttributeSetExecutionData& OutExecutionData)
 {
 	OutExecutionData.Context = Data.EffectSpec.GetContext();
@@ -105,7 +146,7 @@ void UGSCAttributeSetBase::GetExecutionDataFromMod(const FGameplayEffectModCallb
 	OutExecutionData.TargetActor = Data.Target.AbilityActorInfo->AvatarActor.IsValid() ? Data.Target.AbilityActorInfo->AvatarActor.Get() : nullptr;
 	OutExecutionData.TargetController = Data.Target.AbilityActorInfo->PlayerController.IsValid() ? Data.Target.AbilityActorInfo->PlayerController.Get() : nullptr;
 	OutExecutionData.TargetPawn = Cast<APawn>(OutExecutionData.TargetActor);
-	OutExecutionData.TargetCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(OutExecutionData.TargetActor);
+	OutExecutionData.TargetCoreComponent = GetOwnerCoreComponent(OutExecutionData.TargetActor);
 
 	if (OutExecutionData.SourceASC && OutExecutionData.SourceASC->AbilityActorInfo.IsValid())
 	{
@@ -129,7 +170,7 @@ void UGSCAttributeSetBase::GetExecutionDataFromMod(const FGameplayEffectModCallb
 			? OutExecutionData.SourceASC->AbilityActorInfo->PlayerController.Get()
 			: nullptr;
 		OutExecutionData.SourcePawn = Cast<APawn>(OutExecutionData.SourceActor);
-		OutExecutionData.SourceCoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(OutExecutionData.SourceActor);
+		OutExecutionData.SourceCoreComponent = GetSourceCoreComponent(OutExecutionData.SourceActor);
 	}
 
 	OutExecutionData.SourceObject = Data.EffectSpec.GetEffectContext().GetSourceObject();
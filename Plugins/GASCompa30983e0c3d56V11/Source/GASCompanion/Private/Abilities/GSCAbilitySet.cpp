@@ -6,6 +6,7 @@
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCAbilitySystemUtils.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GSCCoreComponent.h"
@@ -108,7 +109,7 @@ bool UGSCAbilitySet::RemoveFromAbilitySystem(UAbilitySystemComponent* InASC, FGS
 	{
 		if (const AActor* AvatarActor = InASC->GetAvatarActor())
 		{
-			InputComponent = AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+			InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarActor);
 		}
 	}
 	
@@ -236,7 +237,7 @@ void UGSCAbilitySet::TryRegisterCoreComponentDelegates(UAbilitySystemComponent*
 	}
 
 	// UGSCCoreComponent could be added to avatars
-	if (UGSCCoreComponent* CoreComponent = AvatarActor->FindComponentByClass<UGSCCoreComponent>())
+	if (UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor))
 	{
 		// Make sure to notify we may have added attributes (on server)
 		CoreComponent->RegisterAbilitySystemDelegates(InASC);
@@ -259,7 +260,7 @@ void UGSCAbilitySet::TryUnregisterCoreComponentDelegates(UAbilitySystemComponent
 	}
 
 	// UGSCCoreComponent could be added to avatars
-	if (UGSCCoreComponent* CoreComponent = AvatarActor->FindComponentByClass<UGSCCoreComponent>())
+	if (UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor))
 	{
 		// Make sure to notify we may have removed attributes (on server)
 		CoreComponent->ShutdownAbilitySystemDelegates(InASC);
@@ -54,7 +54,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 	// Clear up abilities / bindings
-	UGSCAbilityInputBindingComponent* InputComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	UGSCAbilityInputBindingComponent* InputComponent = AbilityActorInfo ? UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AbilityActorInfo->AvatarActor.Get()) : nullptr;
 
 	for (const FGSCMappedAbility& DefaultAbilityHandle : AddedAbilityHandles)
 	{
@@ -71,7 +71,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 	// Clear up any bound delegates in Core Component that were registered from InitAbilityActorInfo
-	UGSCCoreComponent* CoreComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCCoreComponent>() : nullptr;
+	UGSCCoreComponent* CoreComponent = AbilityActorInfo ? UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AbilityActorInfo->AvatarActor.Get()) : nullptr;
 	if (CoreComponent)
 	{
 		CoreComponent->ShutdownAbilitySystemDelegates(this);
@@ -98,6 +98,9 @@ void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 		return;
 	}
 
+	// Avatar may have changed, resolve its companion components once here rather than on every ability callback
+	AvatarComponentCache.Resolve(InAvatarActor);
+
 	if (AbilityActorInfo && InOwnerActor)
 	{
 		if (AbilityActorInfo->AnimInstance == nullptr)
@@ -163,9 +166,13 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 	// ---------------------------------------------------------
 
 	ABILITYLIST_SCOPE_LOCK();
-	for (FGameplayAbilitySpec& Spec : ActivatableAbilities.Items)
+	TArray<int32, TInlineAllocator<4>> SpecIndices;
+	GatherAbilitySpecsForInput(InputID, SpecIndices);
+
+	for (const int32 SpecIndex : SpecIndices)
 	{
-		if (Spec.InputID == InputID && Spec.Ability)
+		FGameplayAbilitySpec& Spec = ActivatableAbilities.Items[SpecIndex];
+		if (Spec.Ability)
 		{
 			Spec.InputPressed = true;
 
@@ -223,6 +230,46 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	}
 }
 
+void UGSCAbilitySystemComponent::AbilityLocalInputReleased(const int32 InputID)
+{
+	ABILITYLIST_SCOPE_LOCK();
+	TArray<int32, TInlineAllocator<4>> SpecIndices;
+	GatherAbilitySpecsForInput(InputID, SpecIndices);
+
+	for (const int32 SpecIndex : SpecIndices)
+	{
+		FGameplayAbilitySpec& Spec = ActivatableAbilities.Items[SpecIndex];
+		Spec.InputPressed = false;
+
+		if (Spec.Ability && Spec.IsActive())
+		{
+			if (Spec.Ability->bReplicateInputDirectly && IsOwnerActorAuthoritative() == false)
+			{
+				ServerSetInputReleased(Spec.Handle);
+			}
+
+			AbilitySpecInputReleased(Spec);
+
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			TArray<UGameplayAbility*> Instances = Spec.GetAbilityInstances();
+			const FGameplayAbilityActivationInfo& ActivationInfo = Instances.IsEmpty() ? Spec.ActivationInfo : Instances.Last()->GetCurrentActivationInfoRef();
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputReleased, Spec.Handle, ActivationInfo.GetActivationPredictionKey());
+		}
+	}
+}
+
+const FGSCAvatarComponentCache& UGSCAbilitySystemComponent::GetAvatarComponentCache()
+{
+	const AActor* Avatar = GetAvatarActor_Direct();
+	if (!AvatarComponentCache.bResolved || AvatarComponentCache.Avatar.Get() != Avatar)
+	{
+		AvatarComponentCache.Resolve(Avatar);
+	}
+
+	return AvatarComponentCache;
+}
+
 FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::GrantAbility(const TSubclassOf<UGameplayAbility> Ability, const bool bRemoveAfterActivation)
 {
 	FGameplayAbilitySpecHandle AbilityHandle;
@@ -437,7 +484,7 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 		InputBindingDelegateHandles.Empty();
 	}
 
-	UGSCAbilityInputBindingComponent* InputComponent = IsValid(InAvatarActor) ? InAvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	UGSCAbilityInputBindingComponent* InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(InAvatarActor);
 
 	// Startup abilities
 	// ReSharper disable once CppUseStructuredBinding
@@ -543,7 +590,7 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitySets(AActor* InOwnerActor, A
 					return;
 				}
 
-				const UGSCAbilityInputBindingComponent* InputBindingComponent = AvatarPawn->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+				const UGSCAbilityInputBindingComponent* InputBindingComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarPawn);
 				if (!InputBindingComponent)
 				{
 					const FText FormatText = NSLOCTEXT(
@@ -574,10 +621,104 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitySets(AActor* InOwnerActor, A
 void UGSCAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
 {
 	Super::OnGiveAbility(AbilitySpec);
+
+	// Append the new spec to the input index when it lives in the activatable list, otherwise fall back to a full rebuild
+	const int32 SpecIndex = static_cast<int32>(&AbilitySpec - ActivatableAbilities.Items.GetData());
+	if (!bAbilityInputIndexDirty && ActivatableAbilities.Items.IsValidIndex(SpecIndex))
+	{
+		if (AbilitySpec.InputID != INDEX_NONE)
+		{
+			AbilityInputIndex.FindOrAdd(AbilitySpec.InputID).Add({ AbilitySpec.Handle, SpecIndex });
+		}
+	}
+	else
+	{
+		bAbilityInputIndexDirty = true;
+	}
 	GSC_WLOG(Verbose, TEXT("%s"), *AbilitySpec.GetDebugString());
 	OnGiveAbilityDelegate.Broadcast(AbilitySpec);
 }
 
+void UGSCAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	// Removal shuffles ActivatableAbilities, indices can't be patched in place
+	bAbilityInputIndexDirty = true;
+}
+
+void UGSCAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Replicated list may have been reordered or had InputIDs changed
+	bAbilityInputIndexDirty = true;
+}
+
+void UGSCAbilitySystemComponent::RebuildAbilityInputIndex()
+{
+	AbilityInputIndex.Reset();
+
+	for (int32 SpecIndex = 0; SpecIndex < ActivatableAbilities.Items.Num(); ++SpecIndex)
+	{
+		const FGameplayAbilitySpec& AbilitySpec = ActivatableAbilities.Items[SpecIndex];
+		if (AbilitySpec.InputID != INDEX_NONE)
+		{
+			AbilityInputIndex.FindOrAdd(AbilitySpec.InputID).Add({ AbilitySpec.Handle, SpecIndex });
+		}
+	}
+
+	bAbilityInputIndexDirty = false;
+}
+
+void UGSCAbilitySystemComponent::GatherAbilitySpecsForInput(const int32 InputID, TArray<int32, TInlineAllocator<4>>& OutSpecIndices)
+{
+	if (bAbilityInputIndexDirty)
+	{
+		RebuildAbilityInputIndex();
+	}
+
+	if (ResolveAbilityInputIndex(InputID, OutSpecIndices))
+	{
+		return;
+	}
+
+	// An indexed spec was removed, moved or had its InputID changed without notifying us, rebuild once and use the fresh entries
+	GSC_PLOG(Verbose, TEXT("Input index stale for InputID %d, rebuilding"), InputID);
+	RebuildAbilityInputIndex();
+	ResolveAbilityInputIndex(InputID, OutSpecIndices);
+}
+
+bool UGSCAbilitySystemComponent::ResolveAbilityInputIndex(const int32 InputID, TArray<int32, TInlineAllocator<4>>& OutSpecIndices) const
+{
+	OutSpecIndices.Reset();
+
+	const TArray<FAbilityInputIndexEntry, TInlineAllocator<2>>* Entries = AbilityInputIndex.Find(InputID);
+	if (!Entries)
+	{
+		// The index is authoritative, specs bound in place show up once MarkAbilityInputIndexDirty() is called
+		return true;
+	}
+
+	for (const FAbilityInputIndexEntry& Entry : *Entries)
+	{
+		if (!ActivatableAbilities.Items.IsValidIndex(Entry.SpecIndex))
+		{
+			return false;
+		}
+
+		const FGameplayAbilitySpec& AbilitySpec = ActivatableAbilities.Items[Entry.SpecIndex];
+		if (AbilitySpec.Handle != Entry.Handle || AbilitySpec.InputID != InputID)
+		{
+			return false;
+		}
+
+		OutSpecIndices.Add(Entry.SpecIndex);
+	}
+
+	return true;
+}
+
 void UGSCAbilitySystemComponent::GrantStartupEffects()
 {
 	if (!IsOwnerActorAuthoritative())
@@ -640,3 +781,23 @@ void UGSCAbilitySystemComponent::HandleOnGiveAbility(FGameplayAbilitySpec& Abili
 		InputComponent->SetInputBinding(InputAction, TriggerEvent, AbilitySpec.Handle);
 	}
 }
+
+void FGSCAvatarComponentCache::Resolve(const AActor* InAvatar)
+{
+	Avatar = InAvatar;
+	bResolved = true;
+
+	if (!IsValid(InAvatar))
+	{
+		CoreComponent.Reset();
+		AbilityQueueComponent.Reset();
+		ComboManagerComponent.Reset();
+		AbilityInputBindingComponent.Reset();
+		return;
+	}
+
+	CoreComponent = InAvatar->FindComponentByClass<UGSCCoreComponent>();
+	AbilityQueueComponent = InAvatar->FindComponentByClass<UGSCAbilityQueueComponent>();
+	ComboManagerComponent = InAvatar->FindComponentByClass<UGSCComboManagerComponent>();
+	AbilityInputBindingComponent = InAvatar->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+}
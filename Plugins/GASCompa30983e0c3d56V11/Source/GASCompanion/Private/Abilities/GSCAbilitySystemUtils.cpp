@@ -4,6 +4,7 @@
 
 #include "GSCLog.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Engine/GameInstance.h"
@@ -96,7 +97,7 @@ void FGSCAbilitySystemUtils::TryBindAbilityInput(UAbilitySystemComponent* InASC,
 	// have all required components
 	UGSCAbilityInputBindingComponent* InputComponent = OutComponentRequests != nullptr  ?
 		Cast<UGSCAbilityInputBindingComponent>(FindOrAddComponentForActor(UGSCAbilityInputBindingComponent::StaticClass(), TargetPawn, *OutComponentRequests)) :
-		TargetPawn->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+		UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(TargetPawn);
 	
 	if (InputComponent)
 	{
@@ -4,6 +4,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemGlobals.h"
+#include "AbilitySystemInterface.h"
 #include "GSCLog.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
@@ -11,6 +12,27 @@
 #include "Components/GSCComboManagerComponent.h"
 #include "Components/GSCCoreComponent.h"
 
+namespace GSCBlueprintFunctionLibrary_Impl
+{
+	/**
+	 * Returns the companion ASC for which Actor is the avatar, going through IAbilitySystemInterface only.
+	 *
+	 * Unlike UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(), this never falls back to a component search,
+	 * so that component getters below can use the ASC avatar component cache without paying for a search first.
+	 */
+	static UGSCAbilitySystemComponent* FindAvatarAbilitySystemComponent(const AActor* Actor)
+	{
+		const IAbilitySystemInterface* AbilitySystemInterface = Cast<IAbilitySystemInterface>(Actor);
+		if (!AbilitySystemInterface)
+		{
+			return nullptr;
+		}
+
+		UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemInterface->GetAbilitySystemComponent());
+		return ASC && ASC->GetAvatarActor_Direct() == Actor ? ASC : nullptr;
+	}
+}
+
 UGSCAbilitySystemComponent* UGSCBlueprintFunctionLibrary::GetCompanionAbilitySystemComponent(const AActor* Actor)
 {
 	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
@@ -35,6 +57,11 @@ UGSCComboManagerComponent* UGSCBlueprintFunctionLibrary::GetComboManagerComponen
 		return nullptr;
 	}
 
+	if (UGSCAbilitySystemComponent* ASC = GSCBlueprintFunctionLibrary_Impl::FindAvatarAbilitySystemComponent(Actor))
+	{
+		return ASC->GetAvatarComponentCache().ComboManagerComponent.Get();
+	}
+
 	// Fall back to a component search to better support BP-only actors
 	return Actor->FindComponentByClass<UGSCComboManagerComponent>();
 }
@@ -46,6 +73,11 @@ UGSCCoreComponent* UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(const
 		return nullptr;
 	}
 
+	if (UGSCAbilitySystemComponent* ASC = GSCBlueprintFunctionLibrary_Impl::FindAvatarAbilitySystemComponent(Actor))
+	{
+		return ASC->GetAvatarComponentCache().CoreComponent.Get();
+	}
+
 	// Fall back to a component search to better support BP-only actors
 	return Actor->FindComponentByClass<UGSCCoreComponent>();
 }
@@ -57,6 +89,11 @@ UGSCAbilityQueueComponent* UGSCBlueprintFunctionLibrary::GetAbilityQueueComponen
 		return nullptr;
 	}
 
+	if (UGSCAbilitySystemComponent* ASC = GSCBlueprintFunctionLibrary_Impl::FindAvatarAbilitySystemComponent(Actor))
+	{
+		return ASC->GetAvatarComponentCache().AbilityQueueComponent.Get();
+	}
+
 	return Actor->FindComponentByClass<UGSCAbilityQueueComponent>();
 }
 
@@ -67,10 +104,28 @@ UGSCAbilityInputBindingComponent* UGSCBlueprintFunctionLibrary::GetAbilityInputB
 		return nullptr;
 	}
 
+	if (UGSCAbilitySystemComponent* ASC = GSCBlueprintFunctionLibrary_Impl::FindAvatarAbilitySystemComponent(Actor))
+	{
+		return ASC->GetAvatarComponentCache().AbilityInputBindingComponent.Get();
+	}
+
 	// Fall back to a component search to better support BP-only actors
 	return Actor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
 }
 
+void UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(const AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (UGSCAbilitySystemComponent* ASC = GSCBlueprintFunctionLibrary_Impl::FindAvatarAbilitySystemComponent(Actor))
+	{
+		ASC->InvalidateAvatarComponentCache();
+	}
+}
+
 bool UGSCBlueprintFunctionLibrary::AddLooseGameplayTagsToActor(AActor* Actor, const FGameplayTagContainer GameplayTags)
 {
 	UAbilitySystemComponent* AbilitySystemComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Actor);
@@ -0,0 +1,280 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCCooldownTracker.h"
+
+FGSCCooldownTracker::FGSCCooldownTracker(const double InSlotDuration)
+	: SlotDuration(FMath::Max(InSlotDuration, UE_KINDA_SMALL_NUMBER))
+{
+	for (int32& BucketHead : BucketHeads)
+	{
+		BucketHead = INDEX_NONE;
+	}
+}
+
+void FGSCCooldownTracker::Start(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, const double Now, const float TimeRemaining, const float Duration)
+{
+	Cancel(AbilitySpecHandle);
+
+	// Idle wheel, catch up with current time right away
+	if (EntryIndexByHandle.Num() == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, GetTickForTime(Now));
+	}
+
+	const int32 EntryIndex = Entries.Add(FEntry());
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.AbilitySpecHandle = AbilitySpecHandle;
+	Entry.CooldownTags = CooldownTags;
+	Entry.EndTime = Now + TimeRemaining;
+	Entry.Duration = Duration;
+
+	// Round up so that expiration is never reported early
+	Entry.ExpiryTick = FMath::Max(CurrentTick + 1, static_cast<int64>(FMath::CeilToDouble(Entry.EndTime / SlotDuration)));
+
+	EntryIndexByHandle.Add(AbilitySpecHandle, EntryIndex);
+	for (const FGameplayTag& CooldownTag : CooldownTags)
+	{
+		++CooldownTagCounts.FindOrAdd(CooldownTag);
+	}
+
+	Link(EntryIndex);
+}
+
+bool FGSCCooldownTracker::Cancel(const FGameplayAbilitySpecHandle& AbilitySpecHandle)
+{
+	const int32* EntryIndex = EntryIndexByHandle.Find(AbilitySpecHandle);
+	if (!EntryIndex)
+	{
+		return false;
+	}
+
+	const int32 Index = *EntryIndex;
+	Unlink(Index);
+	Remove(Index);
+	return true;
+}
+
+bool FGSCCooldownTracker::Expire(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FOnCooldownExpired OnExpired)
+{
+	const int32* EntryIndex = EntryIndexByHandle.Find(AbilitySpecHandle);
+	if (!EntryIndex)
+	{
+		return false;
+	}
+
+	const int32 Index = *EntryIndex;
+	Unlink(Index);
+	RemoveExpired(Index, OnExpired);
+	return true;
+}
+
+void FGSCCooldownTracker::Advance(const double Now, const FOnCooldownExpired OnExpired)
+{
+	const int64 TargetTick = GetTickForTime(Now);
+
+	while (CurrentTick < TargetTick && EntryIndexByHandle.Num() > 0)
+	{
+		++CurrentTick;
+
+		const int32 Level0Slot = static_cast<int32>(CurrentTick & (NumLevel0Slots - 1));
+		if (Level0Slot == 0)
+		{
+			const int64 Level1Tick = CurrentTick >> Level0Bits;
+			const int32 Level1Slot = static_cast<int32>(Level1Tick & (NumLevel1Slots - 1));
+			if (Level1Slot == 0)
+			{
+				Cascade(OverflowBucket);
+			}
+
+			Cascade(NumLevel0Slots + Level1Slot);
+		}
+
+		// Pop entries one at a time, OnExpired may start or cancel other cooldowns
+		while (BucketHeads[Level0Slot] != INDEX_NONE)
+		{
+			const int32 EntryIndex = BucketHeads[Level0Slot];
+			Unlink(EntryIndex);
+			RemoveExpired(EntryIndex, OnExpired);
+		}
+	}
+
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+}
+
+void FGSCCooldownTracker::Reset()
+{
+	Entries.Reset();
+	EntryIndexByHandle.Reset();
+	CooldownTagCounts.Reset();
+
+	for (int32& BucketHead : BucketHeads)
+	{
+		BucketHead = INDEX_NONE;
+	}
+}
+
+bool FGSCCooldownTracker::IsTracking(const FGameplayAbilitySpecHandle& AbilitySpecHandle) const
+{
+	return EntryIndexByHandle.Contains(AbilitySpecHandle);
+}
+
+float FGSCCooldownTracker::GetTimeRemaining(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const double Now) const
+{
+	const int32* EntryIndex = EntryIndexByHandle.Find(AbilitySpecHandle);
+	if (!EntryIndex)
+	{
+		return 0.f;
+	}
+
+	return static_cast<float>(FMath::Max(Entries[*EntryIndex].EndTime - Now, 0.0));
+}
+
+float FGSCCooldownTracker::GetRemainingFraction(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const double Now) const
+{
+	const int32* EntryIndex = EntryIndexByHandle.Find(AbilitySpecHandle);
+	if (!EntryIndex)
+	{
+		return 0.f;
+	}
+
+	const FEntry& Entry = Entries[*EntryIndex];
+	if (Entry.Duration <= 0.f)
+	{
+		return 0.f;
+	}
+
+	return FMath::Clamp(static_cast<float>((Entry.EndTime - Now) / Entry.Duration), 0.f, 1.f);
+}
+
+bool FGSCCooldownTracker::HasAnyCooldownTag(const FGameplayTagContainer& Tags) const
+{
+	if (CooldownTagCounts.Num() == 0)
+	{
+		return false;
+	}
+
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (CooldownTagCounts.Contains(Tag))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FGSCCooldownTracker::GetCooldownsWithAnyTag(const FGameplayTagContainer& Tags, TArray<FGameplayAbilitySpecHandle>& OutAbilitySpecHandles) const
+{
+	if (!HasAnyCooldownTag(Tags))
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.CooldownTags.HasAnyExact(Tags))
+		{
+			OutAbilitySpecHandles.Add(Entry.AbilitySpecHandle);
+		}
+	}
+}
+
+int64 FGSCCooldownTracker::GetTickForTime(const double Time) const
+{
+	return static_cast<int64>(FMath::FloorToDouble(Time / SlotDuration));
+}
+
+void FGSCCooldownTracker::Link(const int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+
+	const int64 Delta = Entry.ExpiryTick - CurrentTick;
+	if (Delta < NumLevel0Slots)
+	{
+		// Already due entries (cascaded on the tick they expire) land in the slot processed right after cascading
+		const int64 Tick = FMath::Max(Entry.ExpiryTick, CurrentTick);
+		Entry.Bucket = static_cast<int32>(Tick & (NumLevel0Slots - 1));
+	}
+	else if (Delta < NumLevel0Slots * NumLevel1Slots)
+	{
+		Entry.Bucket = NumLevel0Slots + static_cast<int32>((Entry.ExpiryTick >> Level0Bits) & (NumLevel1Slots - 1));
+	}
+	else
+	{
+		Entry.Bucket = OverflowBucket;
+	}
+
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = BucketHeads[Entry.Bucket];
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = EntryIndex;
+	}
+
+	BucketHeads[Entry.Bucket] = EntryIndex;
+}
+
+void FGSCCooldownTracker::Unlink(const int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	if (Entry.Prev != INDEX_NONE)
+	{
+		Entries[Entry.Prev].Next = Entry.Next;
+	}
+	else
+	{
+		BucketHeads[Entry.Bucket] = Entry.Next;
+	}
+
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = Entry.Prev;
+	}
+
+	Entry.Bucket = INDEX_NONE;
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = INDEX_NONE;
+}
+
+void FGSCCooldownTracker::Remove(const int32 EntryIndex)
+{
+	Forget(Entries[EntryIndex]);
+	Entries.RemoveAt(EntryIndex);
+}
+
+void FGSCCooldownTracker::RemoveExpired(const int32 EntryIndex, const FOnCooldownExpired OnExpired)
+{
+	// Entry is released before calling back, so that the cooldown can be started again from OnExpired
+	const FEntry Entry = MoveTemp(Entries[EntryIndex]);
+	Entries.RemoveAt(EntryIndex);
+	Forget(Entry);
+
+	OnExpired(Entry.AbilitySpecHandle, Entry.CooldownTags, Entry.Duration);
+}
+
+void FGSCCooldownTracker::Forget(const FEntry& Entry)
+{
+	EntryIndexByHandle.Remove(Entry.AbilitySpecHandle);
+	for (const FGameplayTag& CooldownTag : Entry.CooldownTags)
+	{
+		int32* Count = CooldownTagCounts.Find(CooldownTag);
+		if (Count && --(*Count) <= 0)
+		{
+			CooldownTagCounts.Remove(CooldownTag);
+		}
+	}
+}
+
+void FGSCCooldownTracker::Cascade(const int32 Bucket)
+{
+	int32 EntryIndex = BucketHeads[Bucket];
+	BucketHeads[Bucket] = INDEX_NONE;
+
+	while (EntryIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Entries[EntryIndex].Next;
+		Link(EntryIndex);
+		EntryIndex = NextIndex;
+	}
+}
@@ -24,12 +24,9 @@ FGSCGameplayEffectContainerSpec UGSCGameplayAbility::MakeEffectContainerSpecFrom
 		// If we have a target type, run the targeting logic. This is optional, targets can be added later
 		if (Container.TargetType.Get())
 		{
-			TArray<FHitResult> HitResults;
-			TArray<AActor*> TargetActors;
 			const UGSCTargetType* TargetTypeCDO = Container.TargetType.GetDefaultObject();
 			AActor* AvatarActor = GetAvatarActorFromActorInfo();
-			TargetTypeCDO->GetTargets(AvatarActor, EventData, HitResults, TargetActors);
-			ReturnSpec.AddTargets(HitResults, TargetActors);
+			TargetTypeCDO->AppendTargetData(AvatarActor, EventData, ReturnSpec.TargetData);
 		}
 
 		// If we don't have an override level, use the default on the ability itself
@@ -41,7 +38,7 @@ FGSCGameplayEffectContainerSpec UGSCGameplayAbility::MakeEffectContainerSpecFrom
 		// Build GameplayEffectSpecs for each applied effect
 		for (const TSubclassOf<UGameplayEffect>& EffectClass : Container.TargetGameplayEffectClasses)
 		{
-			FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(EffectClass, OverrideGameplayLevel);
+			FGameplayEffectSpecHandle SpecHandle = MakeEffectContainerOutgoingSpec(EffectClass, OverrideGameplayLevel);
 
 			FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
 			if (Spec && Container.bUseSetByCallerMagnitude)
@@ -69,6 +66,12 @@ TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainerSpe
 {
 	TArray<FActiveGameplayEffectHandle> AllEffects;
 
+	if (bBatchEffectContainerApplication)
+	{
+		ApplyEffectContainerSpecBatched(ContainerSpec, AllEffects);
+		return AllEffects;
+	}
+
 	// Iterate list of effect specs and apply them to their target data
 	for (const FGameplayEffectSpecHandle& SpecHandle : ContainerSpec.TargetGameplayEffectSpecs)
 	{
@@ -77,16 +80,138 @@ TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainerSpe
 	return AllEffects;
 }
 
+void UGSCGameplayAbility::ApplyEffectContainerSpecBatched(const FGSCGameplayEffectContainerSpec& ContainerSpec, TArray<FActiveGameplayEffectHandle>& OutEffectHandles) const
+{
+	const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+	const FGameplayAbilityActivationInfo ActivationInfo = GetCurrentActivationInfo();
+	UAbilitySystemComponent* OwningASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!OwningASC || ContainerSpec.TargetGameplayEffectSpecs.Num() == 0 || !HasAuthorityOrPredictionKey(ActorInfo, &ActivationInfo))
+	{
+		return;
+	}
+
+	// Targets of each target data, as a range of TargetASCs
+	struct FTargetDataRange
+	{
+		const FGameplayAbilityTargetData* TargetData;
+		int32 First;
+		int32 Num;
+	};
+
+	TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+	TArray<FTargetDataRange, TInlineAllocator<4>> Ranges;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : ContainerSpec.TargetData.Data)
+	{
+		if (!TargetData.IsValid())
+		{
+			continue;
+		}
+
+		const int32 First = TargetASCs.Num();
+		for (const TWeakObjectPtr<AActor>& Actor : TargetData->GetActors())
+		{
+			if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor.Get()))
+			{
+				TargetASCs.Add(TargetASC);
+			}
+		}
+
+		if (TargetASCs.Num() > First)
+		{
+			Ranges.Add({ TargetData.Get(), First, TargetASCs.Num() - First });
+		}
+	}
+
+	if (TargetASCs.Num() == 0)
+	{
+		return;
+	}
+
+	OutEffectHandles.Reserve(OutEffectHandles.Num() + TargetASCs.Num() * ContainerSpec.TargetGameplayEffectSpecs.Num());
+
+	FScopedTargetListLock ActiveScopeLock(*OwningASC, *this);
+	const FPredictionKey PredictionKey = OwningASC->GetPredictionKeyForNewAction();
+
+	for (const FGameplayEffectSpecHandle& SpecHandle : ContainerSpec.TargetGameplayEffectSpecs)
+	{
+		const FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+		UAbilitySystemComponent* InstigatorASC = Spec && Spec->GetContext().IsValid() ? Spec->GetContext().GetInstigatorAbilitySystemComponent() : nullptr;
+		if (!InstigatorASC)
+		{
+			continue;
+		}
+
+		for (const FTargetDataRange& Range : Ranges)
+		{
+			// Target data only adds its hit result and origin to the context, same for all of its targets
+			FGameplayEffectSpec SpecToApply(*Spec);
+			FGameplayEffectContextHandle EffectContext = Spec->GetContext().Duplicate();
+			Range.TargetData->AddTargetDataToContext(EffectContext, false);
+			SpecToApply.SetContext(EffectContext, true);
+
+			for (int32 Index = Range.First; Index < Range.First + Range.Num; ++Index)
+			{
+				OutEffectHandles.Add(InstigatorASC->ApplyGameplayEffectSpecToTarget(SpecToApply, TargetASCs[Index], PredictionKey));
+			}
+		}
+	}
+}
+
 TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainer(FGameplayTag ContainerTag, const FGameplayEventData& EventData, int32 OverrideGameplayLevel)
 {
 	const FGSCGameplayEffectContainerSpec Spec = MakeEffectContainerSpec(ContainerTag, EventData, OverrideGameplayLevel);
 	return ApplyEffectContainerSpec(Spec);
 }
 
+FGameplayEffectSpecHandle UGSCGameplayAbility::MakeEffectContainerOutgoingSpec(const TSubclassOf<UGameplayEffect> EffectClass, const int32 Level)
+{
+	// Non instanced abilities are shared between actors, nothing to cache there
+	if (!bCacheEffectContainerSpecs || !IsInstantiated() || !EffectClass)
+	{
+		return MakeOutgoingGameplayEffectSpec(EffectClass, Level);
+	}
+
+	FGameplayEffectSpecHandle& CachedSpec = CachedEffectContainerSpecs.FindOrAdd(MakeTuple(EffectClass.Get(), Level));
+	if (!CachedSpec.IsValid())
+	{
+		CachedSpec = MakeOutgoingGameplayEffectSpec(EffectClass, Level);
+		if (!CachedSpec.IsValid())
+		{
+			CachedEffectContainerSpecs.Remove(MakeTuple(EffectClass.Get(), Level));
+			return FGameplayEffectSpecHandle();
+		}
+	}
+
+	FGameplayEffectSpec* NewSpec = new FGameplayEffectSpec(*CachedSpec.Data);
+
+	// Setting a new context on an initialized spec captures source tags and attributes again
+	NewSpec->SetContext(MakeEffectContext(CurrentSpecHandle, CurrentActorInfo));
+
+	// Ability tags, dynamic source tags and SetByCaller magnitudes of the ability spec may have changed since the spec got cached,
+	// apply them again the same way MakeOutgoingGameplayEffectSpec does
+	FGameplayAbilitySpec* AbilitySpec = GetCurrentAbilitySpec();
+	NewSpec->CapturedSourceTags.GetSpecTags().Reset();
+	ApplyAbilityTagsToGameplayEffectSpec(*NewSpec, AbilitySpec);
+	if (AbilitySpec)
+	{
+		NewSpec->SetByCallerTagMagnitudes = AbilitySpec->SetByCallerTagMagnitudes;
+	}
+
+	return FGameplayEffectSpecHandle(NewSpec);
+}
+
+void UGSCGameplayAbility::InvalidateEffectContainerSpecCache()
+{
+	CachedEffectContainerSpecs.Reset();
+}
+
 void UGSCGameplayAbility::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
 {
 	Super::OnAvatarSet(ActorInfo, Spec);
 
+	// Cached specs were built with the previous avatar
+	InvalidateEffectContainerSpecCache();
+
 	if (bActivateOnGranted)
 	{
 		ActorInfo->AbilitySystemComponent->TryActivateAbility(Spec.Handle, false);
@@ -171,7 +296,7 @@ bool UGSCGameplayAbility::CheckForPositiveCost(const FGameplayAbilitySpecHandle
 		return true;
 	}
 
-	if (!CanApplyPositiveAttributeModifiers(CostGE, ActorInfo, GetAbilityLevel(Handle, ActorInfo), MakeEffectContext(Handle, ActorInfo)))
+	if (!CanApplyPositiveCostAttributes(CostGE, ActorInfo))
 	{
 		const FGameplayTag& CostTag = UAbilitySystemGlobals::Get().ActivateFailCostTag;
 		if (OptionalRelevantTags && CostTag.IsValid())
@@ -227,6 +352,53 @@ bool UGSCGameplayAbility::CanApplyPositiveAttributeModifiers(const UGameplayEffe
 	return true;
 }
 
+bool UGSCGameplayAbility::CanApplyPositiveCostAttributes(const UGameplayEffect* GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo) const
+{
+	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.IsValid() ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!ASC)
+	{
+		return false;
+	}
+
+	CompileCostCheckAttributes(GameplayEffect);
+
+	for (const FGameplayAttribute& Attribute : CostCheckAttributes)
+	{
+		if (!ASC->HasAttributeSetForAttribute(Attribute))
+		{
+			continue;
+		}
+
+		const UAttributeSet* Set = GetAttributeSubobjectForASC(ASC, Attribute.GetAttributeSetClass());
+		if (Attribute.GetNumericValueChecked(Set) <= 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UGSCGameplayAbility::CompileCostCheckAttributes(const UGameplayEffect* GameplayEffect) const
+{
+	if (CostCheckEffect.Get() == GameplayEffect)
+	{
+		return;
+	}
+
+	// Modifier magnitudes don't take part in the check, only which attributes are modified additively
+	CostCheckAttributes.Reset();
+	for (const FGameplayModifierInfo& ModDef : GameplayEffect->Modifiers)
+	{
+		if (ModDef.ModifierOp == EGameplayModOp::Additive && ModDef.Attribute.IsValid())
+		{
+			CostCheckAttributes.AddUnique(ModDef.Attribute);
+		}
+	}
+
+	CostCheckEffect = GameplayEffect;
+}
+
 const UAttributeSet* UGSCGameplayAbility::GetAttributeSubobjectForASC(UAbilitySystemComponent* AbilitySystemComponent, const TSubclassOf<UAttributeSet> AttributeClass)
 {
 	check(AbilitySystemComponent != nullptr);
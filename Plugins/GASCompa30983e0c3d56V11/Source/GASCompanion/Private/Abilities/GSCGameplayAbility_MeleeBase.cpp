@@ -33,7 +33,11 @@ void UGSCGameplayAbility_MeleeBase::ActivateAbility(const FGameplayAbilitySpecHa
 		return;
 	}
 
-	ComboManagerComponent->IncrementCombo();
+	// Predicted activations carry their combo index
+	if (!ComboManagerComponent->ApplyComboActivationData(TriggerEventData, ActivationInfo))
+	{
+		ComboManagerComponent->IncrementCombo();
+	}
 
 	UAnimMontage* Montage = GetNextComboMontage();
 
@@ -2,8 +2,18 @@
 
 
 #include "Abilities/GSCTargetType.h"
+#include "Abilities/GSCTypes.h"
 #include "Abilities/GameplayAbilityTypes.h"
 
 void UGSCTargetType::GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const
 {
 }
+
+void UGSCTargetType::AppendTargetData(AActor* TargetingActor, const FGameplayEventData& EventData, FGameplayAbilityTargetDataHandle& OutTargetData) const
+{
+	TArray<FHitResult> HitResults;
+	TArray<AActor*> TargetActors;
+	GetTargets(TargetingActor, EventData, HitResults, TargetActors);
+
+	FGSCGameplayEffectContainerSpec::AddTargets(OutTargetData, HitResults, TargetActors);
+}
@@ -14,17 +14,22 @@ bool FGSCGameplayEffectContainerSpec::HasValidTargets() const
 }
 
 void FGSCGameplayEffectContainerSpec::AddTargets(const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors)
+{
+	AddTargets(TargetData, HitResults, TargetActors);
+}
+
+void FGSCGameplayEffectContainerSpec::AddTargets(FGameplayAbilityTargetDataHandle& OutTargetData, const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors)
 {
 	for (const FHitResult& HitResult : HitResults)
 	{
 		FGameplayAbilityTargetData_SingleTargetHit* NewData = new FGameplayAbilityTargetData_SingleTargetHit(HitResult);
-		TargetData.Add(NewData);
+		OutTargetData.Add(NewData);
 	}
 
 	if (TargetActors.Num() > 0)
 	{
 		FGameplayAbilityTargetData_ActorArray* NewData = new FGameplayAbilityTargetData_ActorArray();
 		NewData->TargetActorArray.Append(TargetActors);
-		TargetData.Add(NewData);
+		OutTargetData.Add(NewData);
 	}
 }
@@ -0,0 +1,9 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/TargetTypes/GSCTargetTypeBox.h"
+
+FCollisionShape UGSCTargetTypeBox::GetCollisionShape() const
+{
+	return FCollisionShape::MakeBox(HalfExtent);
+}
+
@@ -0,0 +1,9 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/TargetTypes/GSCTargetTypeCapsule.h"
+
+FCollisionShape UGSCTargetTypeCapsule::GetCollisionShape() const
+{
+	return FCollisionShape::MakeCapsule(Radius, HalfHeight);
+}
+
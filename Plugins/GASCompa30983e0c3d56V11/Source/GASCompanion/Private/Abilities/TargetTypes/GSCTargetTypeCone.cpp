@@ -0,0 +1,60 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/TargetTypes/GSCTargetTypeCone.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "GameFramework/Actor.h"
+
+FCollisionShape UGSCTargetTypeCone::GetCollisionShape() const
+{
+	return FCollisionShape::MakeSphere(Range);
+}
+
+bool UGSCTargetTypeCone::IsWithinShape(const FTransform& QueryTransform, const FOverlapResult& Overlap) const
+{
+	const AActor* Actor = Overlap.GetActor();
+	if (Actor && IsWithinCone(QueryTransform, Actor->GetActorLocation()))
+	{
+		return true;
+	}
+
+	// Large targets can be within the cone with their location outside of it. Test the point of the component closest to the
+	// cone axis, taken level with the component.
+	const UPrimitiveComponent* Component = Overlap.GetComponent();
+	if (!Component)
+	{
+		return false;
+	}
+
+	const FVector Origin = QueryTransform.GetLocation();
+	const FVector Forward = QueryTransform.GetRotation().GetForwardVector();
+	const FVector AxisPoint = Origin + Forward * FMath::Clamp(FVector::DotProduct(Component->Bounds.Origin - Origin, Forward), 0.0, static_cast<double>(Range));
+
+	// Negative without collision geometry. 0 when the axis point is inside the component, which then returns the axis point itself.
+	FVector ClosestPoint;
+	if (Component->GetClosestPointOnCollision(AxisPoint, ClosestPoint) < 0.f)
+	{
+		return false;
+	}
+
+	return IsWithinCone(QueryTransform, ClosestPoint);
+}
+
+bool UGSCTargetTypeCone::IsWithinCone(const FTransform& QueryTransform, const FVector& Location) const
+{
+	const FVector Direction = Location - QueryTransform.GetLocation();
+	const double DistanceSquared = Direction.SizeSquared();
+	if (DistanceSquared > FMath::Square(Range))
+	{
+		return false;
+	}
+
+	if (DistanceSquared <= UE_SMALL_NUMBER)
+	{
+		return true;
+	}
+
+	const double Dot = FVector::DotProduct(QueryTransform.GetRotation().GetForwardVector(), Direction);
+	return Dot >= FMath::Cos(FMath::DegreesToRadians(HalfAngle)) * FMath::Sqrt(DistanceSquared);
+}
@@ -0,0 +1,186 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/TargetTypes/GSCTargetTypeOverlap.h"
+
+#include "AbilitySystemGlobals.h"
+#include "GenericTeamAgentInterface.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UGSCTargetTypeOverlap::UGSCTargetTypeOverlap()
+{
+	ObjectTypes.Add(ECC_Pawn);
+}
+
+void UGSCTargetTypeOverlap::GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const
+{
+	if (!TargetingActor)
+	{
+		return;
+	}
+
+	GatherTargets(TargetingActor, GetQueryTransform(TargetingActor), [&OutActors](AActor* Target)
+	{
+		OutActors.Add(Target);
+	});
+}
+
+void UGSCTargetTypeOverlap::AppendTargetData(AActor* TargetingActor, const FGameplayEventData& EventData, FGameplayAbilityTargetDataHandle& OutTargetData) const
+{
+	if (!TargetingActor)
+	{
+		return;
+	}
+
+	const FTransform QueryTransform = GetQueryTransform(TargetingActor);
+
+	FGameplayAbilityTargetData_ActorArray* NewData = new FGameplayAbilityTargetData_ActorArray();
+	NewData->SourceLocation.LocationType = EGameplayAbilityTargetingLocationType::LiteralTransform;
+	NewData->SourceLocation.LiteralTransform = QueryTransform;
+
+	GatherTargets(TargetingActor, QueryTransform, [NewData](AActor* Target)
+	{
+		NewData->TargetActorArray.Add(Target);
+	});
+
+	if (NewData->TargetActorArray.Num() == 0)
+	{
+		delete NewData;
+		return;
+	}
+
+	OutTargetData.Add(NewData);
+}
+
+FTransform UGSCTargetTypeOverlap::GetQueryTransform(const AActor* TargetingActor) const
+{
+	const FTransform ActorTransform = TargetingActor->GetActorTransform();
+	return FTransform(ActorTransform.GetRotation(), ActorTransform.TransformPosition(Offset));
+}
+
+void UGSCTargetTypeOverlap::GatherTargets(AActor* TargetingActor, const FTransform& QueryTransform, const TFunctionRef<void(AActor*)> AddTarget) const
+{
+	UWorld* World = TargetingActor->GetWorld();
+	if (!World || ObjectTypes.Num() == 0)
+	{
+		return;
+	}
+
+	FCollisionObjectQueryParams ObjectParams;
+	for (const TEnumAsByte<ECollisionChannel>& ObjectType : ObjectTypes)
+	{
+		ObjectParams.AddObjectTypesToQuery(ObjectType);
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GSCTargetTypeOverlap), false);
+	if (!bIncludeTargetingActor)
+	{
+		QueryParams.AddIgnoredActor(TargetingActor);
+	}
+
+	const FVector Origin = QueryTransform.GetLocation();
+
+	// Single broadphase query, every other filter runs on its results
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, Origin, QueryTransform.GetRotation(), ObjectParams, GetCollisionShape(), QueryParams);
+
+	struct FCandidate
+	{
+		AActor* Actor;
+		double DistanceSquared;
+	};
+
+	TArray<FCandidate, TInlineAllocator<64>> Candidates;
+	Candidates.Reserve(Overlaps.Num());
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		if (!Actor)
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		if (!IsWithinShape(QueryTransform, Overlap) || !PassesTeamFilter(TargetingActor, Actor))
+		{
+			continue;
+		}
+
+		if (bRequireAbilitySystemComponent && !UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
+		{
+			continue;
+		}
+
+		Candidates.Add({ Actor, FVector::DistSquared(Origin, Location) });
+	}
+
+	// Actors overlapping with several components show up several times, sorting puts them next to each other
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.DistanceSquared != B.DistanceSquared)
+		{
+			return A.DistanceSquared < B.DistanceSquared;
+		}
+
+		if (A.Actor->GetFName() != B.Actor->GetFName())
+		{
+			return A.Actor->GetFName().LexicalLess(B.Actor->GetFName());
+		}
+
+		return A.Actor->GetUniqueID() < B.Actor->GetUniqueID();
+	});
+
+	int32 NumTargets = 0;
+	const AActor* PreviousActor = nullptr;
+	for (const FCandidate& Candidate : Candidates)
+	{
+		if (Candidate.Actor == PreviousActor)
+		{
+			continue;
+		}
+
+		PreviousActor = Candidate.Actor;
+
+		// Line of sight is the most expensive filter, only trace for candidates that can still make it
+		if (bRequireLineOfSight)
+		{
+			FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(GSCTargetTypeOverlapLineOfSight), false, TargetingActor);
+			TraceParams.AddIgnoredActor(Candidate.Actor);
+			if (World->LineTraceTestByChannel(Origin, Candidate.Actor->GetActorLocation(), LineOfSightChannel, TraceParams))
+			{
+				continue;
+			}
+		}
+
+		AddTarget(Candidate.Actor);
+
+		if (MaxTargets > 0 && ++NumTargets >= MaxTargets)
+		{
+			break;
+		}
+	}
+}
+
+bool UGSCTargetTypeOverlap::PassesTeamFilter(const AActor* TargetingActor, const AActor* Target) const
+{
+	if (TeamFilter == EGSCTargetTeamFilter::Any)
+	{
+		return true;
+	}
+
+	const ETeamAttitude::Type Attitude = FGenericTeamId::GetAttitude(TargetingActor, Target);
+	switch (TeamFilter)
+	{
+	case EGSCTargetTeamFilter::Hostile:
+		return Attitude == ETeamAttitude::Hostile;
+	case EGSCTargetTeamFilter::NotFriendly:
+		return Attitude != ETeamAttitude::Friendly;
+	case EGSCTargetTeamFilter::Friendly:
+		return Attitude == ETeamAttitude::Friendly;
+	default:
+		return true;
+	}
+}
@@ -0,0 +1,9 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/TargetTypes/GSCTargetTypeSphere.h"
+
+FCollisionShape UGSCTargetTypeSphere::GetCollisionShape() const
+{
+	return FCollisionShape::MakeSphere(Radius);
+}
+
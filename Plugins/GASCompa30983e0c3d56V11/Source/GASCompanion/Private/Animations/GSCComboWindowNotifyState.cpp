@@ -6,7 +6,6 @@
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "Components/GSCComboManagerComponent.h"
-#include "Components/GSCCoreComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 
 void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration)
@@ -17,14 +16,9 @@ void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, U
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server, or on the owning client when it predicts combos (server still tracks it to validate predictions)
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->ShouldTrackComboWindow())
 	{
 		ComboManagerComponent->bComboWindowOpened = true;
 	}
@@ -38,21 +32,20 @@ void UGSCComboWindowNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAn
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server, or on the owning client when it predicts combos (server still tracks it to validate predictions)
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->ShouldTrackComboWindow())
 	{
-		GSC_LOG(Verbose, TEXT("NotifyEnd: bNextComboAbilityActivated %s (%s)"), ComboManagerComponent->bNextComboAbilityActivated ? TEXT("true") : TEXT("false"), *Owner->GetName())
-		GSC_LOG(Verbose, TEXT("NotifyEnd: bEndCombo %s (%s)"), bEndCombo ? TEXT("true") : TEXT("false"), *Owner->GetName())
-		if (!ComboManagerComponent->bNextComboAbilityActivated || bEndCombo)
+		// Predicting owning client resets the combo itself, and lets the server know
+		if (ComboManagerComponent->ShouldHandleComboWindow())
 		{
-			GSC_LOG(Verbose, TEXT("NotifyEnd: ResetCombo  (%s)"), *Owner->GetName())
-			ComboManagerComponent->ResetCombo();
+			GSC_LOG(Verbose, TEXT("NotifyEnd: bNextComboAbilityActivated %s (%s)"), ComboManagerComponent->bNextComboAbilityActivated ? TEXT("true") : TEXT("false"), *Owner->GetName())
+			GSC_LOG(Verbose, TEXT("NotifyEnd: bEndCombo %s (%s)"), bEndCombo ? TEXT("true") : TEXT("false"), *Owner->GetName())
+			if (!ComboManagerComponent->bNextComboAbilityActivated || bEndCombo)
+			{
+				GSC_LOG(Verbose, TEXT("NotifyEnd: ResetCombo  (%s)"), *Owner->GetName())
+				ComboManagerComponent->ResetCombo();
+			}
 		}
 
 		ComboManagerComponent->bComboWindowOpened = false;
@@ -70,29 +63,22 @@ void UGSCComboWindowNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UA
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server, or on the owning client when it predicts combos
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (!ComboManagerComponent)
+	if (!ComboManagerComponent || !ComboManagerComponent->ShouldHandleComboWindow())
 	{
 		return;
 	}
 
 	if (ComboManagerComponent->bComboWindowOpened && ComboManagerComponent->bShouldTriggerCombo && ComboManagerComponent->bRequestTriggerCombo && !bEndCombo)
 	{
-		UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Owner);
 		// prevent reactivate of ability in this tick window (especially on networked environment with some lags)
-		if (CoreComponent && !ComboManagerComponent->bNextComboAbilityActivated)
+		if (!ComboManagerComponent->bNextComboAbilityActivated)
 		{
 			const UGameplayAbility* ComboAbility = ComboManagerComponent->GetCurrentActiveComboAbility();
 			if (ComboAbility)
 			{
-				UGSCGameplayAbility* ActivatedAbility;
-				const bool bSuccess = CoreComponent->ActivateAbilityByClass(ComboAbility->GetClass(), ActivatedAbility);
+				const bool bSuccess = ComboManagerComponent->TryActivateComboAbility(ComboAbility->GetClass());
 				if (bSuccess)
 				{
 					ComboManagerComponent->bNextComboAbilityActivated = true;
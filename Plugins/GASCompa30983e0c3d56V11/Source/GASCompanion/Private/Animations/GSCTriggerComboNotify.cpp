@@ -14,14 +14,9 @@ void UGSCTriggerComboNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run only on server, or on the owning client when it predicts combos
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (!ComboManagerComponent)
+	if (!ComboManagerComponent || !ComboManagerComponent->ShouldHandleComboWindow())
 	{
 		return;
 	}
@@ -5,6 +5,8 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 
 namespace GSCAbilityInputBindingComponent_Impl
 {
@@ -15,6 +17,36 @@ namespace GSCAbilityInputBindingComponent_Impl
 	{
 		return ++IncrementingInputID;
 	}
+
+	/** Updates the spec InputID, and lets GSC ASC know its input index is stale if the value actually changed */
+	static void SetSpecInputID(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAbilitySpec& AbilitySpec, const int32 InputID)
+	{
+		if (AbilitySpec.InputID == InputID)
+		{
+			return;
+		}
+
+		AbilitySpec.InputID = InputID;
+		if (UGSCAbilitySystemComponent* GSCAbilitySystemComponent = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
+		{
+			GSCAbilitySystemComponent->MarkAbilityInputIndexDirty();
+		}
+	}
+}
+
+void UGSCAbilityInputBindingComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Let owner ASC know its avatar component cache needs to pick us up
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+}
+
+void UGSCAbilityInputBindingComponent::OnUnregister()
+{
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+
+	Super::OnUnregister();
 }
 
 void UGSCAbilityInputBindingComponent::SetupPlayerControls_Implementation(UEnhancedInputComponent* PlayerInputComponent)
@@ -130,7 +162,7 @@ void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction
 		FGameplayAbilitySpec* OldBoundAbility = FindAbilitySpec(AbilityInputBinding->BoundAbilitiesStack.Top());
 		if (OldBoundAbility && OldBoundAbility->InputID == AbilityInputBinding->InputID)
 		{
-			OldBoundAbility->InputID = InvalidInputID;
+			SetSpecInputID(AbilityComponent, *OldBoundAbility, InvalidInputID);
 		}
 	}
 	else
@@ -142,7 +174,7 @@ void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction
 
 	if (BindingAbility)
 	{
-		BindingAbility->InputID = AbilityInputBinding->InputID;
+		SetSpecInputID(AbilityComponent, *BindingAbility, AbilityInputBinding->InputID);
 	}
 
 	AbilityInputBinding->BoundAbilitiesStack.Push(AbilityHandle);
@@ -182,7 +214,7 @@ void UGSCAbilityInputBindingComponent::ClearInputBinding(const FGameplayAbilityS
 				FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding.BoundAbilitiesStack.Top());
 				if (StackedAbility && StackedAbility->InputID == 0)
 				{
-					StackedAbility->InputID = AbilityInputBinding.InputID;
+					SetSpecInputID(AbilityComponent, *StackedAbility, AbilityInputBinding.InputID);
 				}
 			}
 			else
@@ -193,7 +225,7 @@ void UGSCAbilityInputBindingComponent::ClearInputBinding(const FGameplayAbilityS
 			// DO NOT act on `AbilityInputBinding` after here (it could have been removed)
 
 
-			FoundAbility->InputID = InvalidInputID;
+			SetSpecInputID(AbilityComponent, *FoundAbility, InvalidInputID);
 		}
 	}
 }
@@ -277,7 +309,7 @@ void UGSCAbilityInputBindingComponent::ResetBindings()
 				FGameplayAbilitySpec* FoundAbility = AbilityComponent->FindAbilitySpecFromHandle(AbilityHandle);
 				if (FoundAbility && FoundAbility->InputID == ExpectedInputID)
 				{
-					FoundAbility->InputID = GSCAbilityInputBindingComponent_Impl::InvalidInputID;
+					GSCAbilityInputBindingComponent_Impl::SetSpecInputID(AbilityComponent, *FoundAbility, GSCAbilityInputBindingComponent_Impl::InvalidInputID);
 				}
 			}
 		}
@@ -318,7 +350,7 @@ void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
 				FGameplayAbilitySpec* FoundAbility = AbilityComponent->FindAbilitySpecFromHandle(AbilityHandle);
 				if (FoundAbility != nullptr)
 				{
-					FoundAbility->InputID = NewInputID;
+					GSCAbilityInputBindingComponent_Impl::SetSpecInputID(AbilityComponent, *FoundAbility, NewInputID);
 				}
 			}
 		}
@@ -346,7 +378,7 @@ void UGSCAbilityInputBindingComponent::UpdateAbilitySystemBindings(UAbilitySyste
 			FGameplayAbilitySpec* FoundAbility = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandle);
 			if (FoundAbility != nullptr)
 			{
-				FoundAbility->InputID = InputID;
+				GSCAbilityInputBindingComponent_Impl::SetSpecInputID(AbilitySystemComponent, *FoundAbility, InputID);
 			}
 		}
 	}
@@ -433,7 +465,7 @@ void UGSCAbilityInputBindingComponent::RemoveEntry(const UInputAction* InputActi
 			FGameplayAbilitySpec* AbilitySpec = FindAbilitySpec(AbilityHandle);
 			if (AbilitySpec && AbilitySpec->InputID == Bindings->InputID)
 			{
-				AbilitySpec->InputID = InvalidInputID;
+				SetSpecInputID(AbilityComponent, *AbilitySpec, InvalidInputID);
 			}
 		}
 
@@ -6,15 +6,15 @@
 #include "AbilitySystemComponent.h"
 #include "GSCDelegates.h"
 #include "GSCLog.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "GameFramework/Pawn.h"
 
 // Sets default values for this component's properties
 UGSCAbilityQueueComponent::UGSCAbilityQueueComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
+	// Ability Queue is entirely event driven (ability ended / failed, anim notifies), no need to tick
+	PrimaryComponentTick.bCanEverTick = false;
 
 	// ...
 	SetIsReplicatedByDefault(true);
@@ -29,6 +29,21 @@ void UGSCAbilityQueueComponent::BeginPlay()
 	SetupOwner();
 }
 
+void UGSCAbilityQueueComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Let owner ASC know its avatar component cache needs to pick us up
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+}
+
+void UGSCAbilityQueueComponent::OnUnregister()
+{
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+
+	Super::OnUnregister();
+}
+
 void UGSCAbilityQueueComponent::SetupOwner()
 {
 	if(!GetOwner())
@@ -70,14 +85,22 @@ void UGSCAbilityQueueComponent::CloseAbilityQueue()
 	bAbilityQueueOpened = false;
 }
 
-void UGSCAbilityQueueComponent::UpdateAllowedAbilitiesForAbilityQueue(TArray<TSubclassOf<UGameplayAbility>> AllowedAbilities)
+void UGSCAbilityQueueComponent::UpdateAllowedAbilitiesForAbilityQueue(const TArray<TSubclassOf<UGameplayAbility>>& AllowedAbilities)
 {
 	if (!bAbilityQueueEnabled)
 	{
 		return;
 	}
 
-	QueuedAllowedAbilities = AllowedAbilities;
+	TSet<TSubclassOf<UGameplayAbility>> NewAllowedAbilities;
+	NewAllowedAbilities.Append(AllowedAbilities);
+
+	if (NewAllowedAbilities.Num() == QueuedAllowedAbilities.Num() && NewAllowedAbilities.Includes(QueuedAllowedAbilities))
+	{
+		return;
+	}
+
+	QueuedAllowedAbilities = MoveTemp(NewAllowedAbilities);
 
 	// Notify Debug Widget if any is on screen
 	UpdateDebugWidgetAllowedAbilities();
@@ -90,6 +113,11 @@ void UGSCAbilityQueueComponent::SetAllowAllAbilitiesForAbilityQueue(const bool b
 		return;
 	}
 
+	if (bAllowAllAbilitiesForAbilityQueue == bAllowAllAbilities)
+	{
+		return;
+	}
+
 	bAllowAllAbilitiesForAbilityQueue = bAllowAllAbilities;
 
 	UpdateDebugWidgetAllowedAbilities();
@@ -112,7 +140,12 @@ const UGameplayAbility* UGSCAbilityQueueComponent::GetCurrentQueuedAbility() con
 
 TArray<TSubclassOf<UGameplayAbility>> UGSCAbilityQueueComponent::GetQueuedAllowedAbilities() const
 {
-    return QueuedAllowedAbilities;
+    return QueuedAllowedAbilities.Array();
+}
+
+bool UGSCAbilityQueueComponent::IsAbilityAllowedForAbilityQueue(const TSubclassOf<UGameplayAbility> AbilityClass) const
+{
+	return bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(AbilityClass);
 }
 
 void UGSCAbilityQueueComponent::OnAbilityEnded(const UGameplayAbility* InAbility)
@@ -154,7 +187,7 @@ void UGSCAbilityQueueComponent::OnAbilityEnded(const UGameplayAbility* InAbility
 			// Store queue ability in a local var, it is cleared in ResetAbilityQueueState
 			const UGameplayAbility* AbilityToActivate = QueuedAbility;
 			GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() has a queued input: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
-			if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(AbilityToActivate->GetClass()))
+			if (IsAbilityAllowedForAbilityQueue(AbilityToActivate->GetClass()))
 			{
 				ResetAbilityQueueState();
 
@@ -185,7 +218,7 @@ void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability,
 		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() Set QueuedAbility to %s"), *Ability->GetName())
 
 		// Only queue the ability if it's allowed (or AllowAllAbilities is turned on)
-		if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(Ability->GetClass()))
+		if (IsAbilityAllowedForAbilityQueue(Ability->GetClass()))
 		{
 			QueuedAbility = TObjectPtr<UGameplayAbility>(const_cast<UGameplayAbility*>(Ability));
 		}
@@ -195,15 +228,24 @@ void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability,
 void UGSCAbilityQueueComponent::ResetAbilityQueueState()
 {
 	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ResetAbilityQueueState()"))
+	const bool bAllowedAbilitiesChanged = bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Num() > 0;
+
 	QueuedAbility = nullptr;
 	bAllowAllAbilitiesForAbilityQueue = false;
-	QueuedAllowedAbilities.Empty();
+	QueuedAllowedAbilities.Reset();
 
 	// Notify Debug Widget if any is on screen
-	UpdateDebugWidgetAllowedAbilities();
+	if (bAllowedAbilitiesChanged)
+	{
+		UpdateDebugWidgetAllowedAbilities();
+	}
 }
 
 void UGSCAbilityQueueComponent::UpdateDebugWidgetAllowedAbilities()
 {
-	FGSCDelegates::OnUpdateAllowedAbilities.Broadcast(QueuedAllowedAbilities);
+	// Skip building the array if no debug widget is listening
+	if (FGSCDelegates::OnUpdateAllowedAbilities.IsBound())
+	{
+		FGSCDelegates::OnUpdateAllowedAbilities.Broadcast(QueuedAllowedAbilities.Array());
+	}
 }
@@ -4,10 +4,12 @@
 #include "Components/GSCComboManagerComponent.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
 #include "Components/GSCCoreComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
 
@@ -20,15 +22,61 @@ UGSCComboManagerComponent::UGSCComboManagerComponent()
 	MeleeBaseAbility = UGSCGameplayAbility_MeleeBase::StaticClass();
 }
 
+bool FGSCComboState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 Packed = 0;
+	if (Ar.IsSaving())
+	{
+		Packed = FMath::Clamp(ComboIndex, 0, MaxComboIndex);
+		Packed |= (bComboWindowOpened ? 1u : 0u) << ComboIndexBits;
+		Packed |= (bShouldTriggerCombo ? 1u : 0u) << (ComboIndexBits + 1);
+		Packed |= (bRequestTriggerCombo ? 1u : 0u) << (ComboIndexBits + 2);
+		Packed |= (bNextComboAbilityActivated ? 1u : 0u) << (ComboIndexBits + 3);
+	}
+
+	Ar.SerializeBits(&Packed, ComboIndexBits + NumFlags);
+
+	if (Ar.IsLoading())
+	{
+		ComboIndex = Packed & MaxComboIndex;
+		bComboWindowOpened = (Packed >> ComboIndexBits) & 1;
+		bShouldTriggerCombo = (Packed >> (ComboIndexBits + 1)) & 1;
+		bRequestTriggerCombo = (Packed >> (ComboIndexBits + 2)) & 1;
+		bNextComboAbilityActivated = (Packed >> (ComboIndexBits + 3)) & 1;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
 void UGSCComboManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ComboIndex, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bComboWindowOpened, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bShouldTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bRequestTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bNextComboAbilityActivated, COND_None, REPNOTIFY_Always);
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = COND_OwnerOnly;
+	Params.RepNotifyCondition = REPNOTIFY_OnChanged;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UGSCComboManagerComponent, ReplicatedComboState, Params);
+}
+
+void UGSCComboManagerComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// When predicting, the owning client handles the combo state itself
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UGSCComboManagerComponent, ReplicatedComboState, !bPredictComboAdvancement);
+	if (bPredictComboAdvancement)
+	{
+		return;
+	}
+
+	const FGSCComboState ComboState = GetComboState();
+	if (ComboState != ReplicatedComboState)
+	{
+		ReplicatedComboState = ComboState;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UGSCComboManagerComponent, ReplicatedComboState, this);
+	}
 }
 
 void UGSCComboManagerComponent::IncrementCombo()
@@ -47,7 +95,7 @@ void UGSCComboManagerComponent::ResetCombo()
 
 void UGSCComboManagerComponent::ActivateComboAbility(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
 {
-	if (IsOwnerActorAuthoritative())
+	if (IsOwnerActorAuthoritative() || IsLocallyPredictingCombo())
 	{
 		ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
 	}
@@ -70,11 +118,130 @@ void UGSCComboManagerComponent::SetComboIndex(const int32 InComboIndex)
 	}
 }
 
+int32 UGSCComboManagerComponent::GetNextComboIndex() const
+{
+	return bComboWindowOpened ? ComboIndex + 1 : ComboIndex;
+}
+
+bool UGSCComboManagerComponent::TryActivateComboAbility(const TSubclassOf<UGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
+{
+	if (!OwnerCoreComponent || !AbilityClass)
+	{
+		return false;
+	}
+
+	// Predicted activations always reach the server, only predict those allowed to activate remotely
+	if (!IsLocallyPredictingCombo() || !bAllowRemoteActivation)
+	{
+		UGSCGameplayAbility* ActivatedAbility;
+		return OwnerCoreComponent->ActivateAbilityByClass(AbilityClass, ActivatedAbility, bAllowRemoteActivation);
+	}
+
+	UAbilitySystemComponent* ASC = OwnerCoreComponent->OwnerAbilitySystemComponent;
+	const FGameplayAbilitySpec* Spec = ASC ? ASC->FindAbilitySpecFromClass(AbilityClass) : nullptr;
+	if (!Spec)
+	{
+		GSC_LOG(Warning, TEXT("UGSCComboManagerComponent::TryActivateComboAbility() %s has no ability spec for %s"), *GetNameSafe(GetOwner()), *AbilityClass->GetName())
+		return false;
+	}
+
+	// The predicted combo index travels with the activation, so that the server plays the same combo montage
+	FGameplayEventData EventData;
+	EventData.OptionalObject = this;
+	EventData.EventMagnitude = GetNextComboIndex();
+
+	return ASC->InternalTryActivateAbility(Spec->Handle, FPredictionKey(), nullptr, nullptr, &EventData);
+}
+
+bool UGSCComboManagerComponent::ApplyComboActivationData(const FGameplayEventData* TriggerEventData, const FGameplayAbilityActivationInfo& ActivationInfo)
+{
+	if (!TriggerEventData || TriggerEventData->OptionalObject != this)
+	{
+		return false;
+	}
+
+	const int32 PredictedComboIndex = FMath::RoundToInt32(TriggerEventData->EventMagnitude);
+
+	if (ActivationInfo.ActivationMode == EGameplayAbilityActivationMode::Predicting)
+	{
+		FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+		PredictionKey.NewRejectedDelegate().BindUObject(this, &UGSCComboManagerComponent::OnComboPredictionRejected, ComboIndex, PredictedComboIndex);
+
+		ComboIndex = PredictedComboIndex;
+		return true;
+	}
+
+	if (!IsOwnerActorAuthoritative())
+	{
+		// Server initiated activation replaying on the owning client, the combo index already matches
+		return true;
+	}
+
+	// A combo can only start over, keep its index, or move forward by one while the combo window is opened on the server as well
+	const bool bValidAdvance = PredictedComboIndex == ComboIndex + 1 && bComboWindowOpened;
+	if (PredictedComboIndex != 0 && PredictedComboIndex != ComboIndex && !bValidAdvance)
+	{
+		GSC_LOG(Warning, TEXT("UGSCComboManagerComponent::ApplyComboActivationData() %s predicted invalid combo index %d (current %d, window %s), correcting"), *GetNameSafe(GetOwner()), PredictedComboIndex, ComboIndex, bComboWindowOpened ? TEXT("opened") : TEXT("closed"))
+		IncrementCombo();
+		ClientCorrectComboIndex(ComboIndex);
+		return true;
+	}
+
+	ComboIndex = PredictedComboIndex;
+	return true;
+}
+
+FGSCComboState UGSCComboManagerComponent::GetComboState() const
+{
+	FGSCComboState ComboState;
+	ComboState.ComboIndex = ComboIndex;
+	ComboState.bComboWindowOpened = bComboWindowOpened;
+	ComboState.bShouldTriggerCombo = bShouldTriggerCombo;
+	ComboState.bRequestTriggerCombo = bRequestTriggerCombo;
+	ComboState.bNextComboAbilityActivated = bNextComboAbilityActivated;
+	return ComboState;
+}
+
+void UGSCComboManagerComponent::SetComboState(const FGSCComboState& InComboState)
+{
+	ComboIndex = InComboState.ComboIndex;
+	bComboWindowOpened = InComboState.bComboWindowOpened;
+	bShouldTriggerCombo = InComboState.bShouldTriggerCombo;
+	bRequestTriggerCombo = InComboState.bRequestTriggerCombo;
+	bNextComboAbilityActivated = InComboState.bNextComboAbilityActivated;
+}
+
 bool UGSCComboManagerComponent::IsOwnerActorAuthoritative() const
 {
 	return !bCachedIsNetSimulated;
 }
 
+bool UGSCComboManagerComponent::IsLocallyPredictingCombo() const
+{
+	return bPredictComboAdvancement && !IsOwnerActorAuthoritative() && OwningCharacter && OwningCharacter->IsLocallyControlled();
+}
+
+bool UGSCComboManagerComponent::ShouldHandleComboWindow() const
+{
+	if (!bPredictComboAdvancement)
+	{
+		return IsOwnerActorAuthoritative();
+	}
+
+	// Server only handles combo windows of the characters it controls, remote owners predict them
+	if (IsOwnerActorAuthoritative())
+	{
+		return !OwningCharacter || OwningCharacter->IsLocallyControlled();
+	}
+
+	return IsLocallyPredictingCombo();
+}
+
+bool UGSCComboManagerComponent::ShouldTrackComboWindow() const
+{
+	return ShouldHandleComboWindow() || (bPredictComboAdvancement && IsOwnerActorAuthoritative());
+}
+
 // Called when the game starts
 void UGSCComboManagerComponent::BeginPlay()
 {
@@ -93,6 +260,16 @@ void UGSCComboManagerComponent::OnRegister()
 
 	// Cached off netrole to avoid constant checking on owning actor
 	CacheIsNetSimulated();
+
+	// Let owner ASC know its avatar component cache needs to pick us up
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+}
+
+void UGSCComboManagerComponent::OnUnregister()
+{
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+
+	Super::OnUnregister();
 }
 
 void UGSCComboManagerComponent::SetupOwner()
@@ -119,8 +296,7 @@ UGameplayAbility* UGSCComboManagerComponent::GetCurrentActiveComboAbility() cons
 		return nullptr;
 	}
 
-	TArray<UGameplayAbility*> Abilities = OwnerCoreComponent->GetActiveAbilitiesByClass(MeleeBaseAbility);
-	return Abilities.IsValidIndex(0) ? Abilities[0] : nullptr;
+	return OwnerCoreComponent->GetFirstActiveAbilityByClass(MeleeBaseAbility);
 }
 
 void UGSCComboManagerComponent::ActivateComboAbilityInternal(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
@@ -162,9 +338,8 @@ void UGSCComboManagerComponent::ActivateComboAbilityInternal(const TSubclassOf<U
 	else
 	{
 		GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::ActivateComboAbility() %s is not in combo, activate %s"), *GetName(), *AbilityClass->GetName())
-	    UGSCGameplayAbility* TempActivateAbility;
-        OwnerCoreComponent->ActivateAbilityByClass(AbilityClass, TempActivateAbility, bAllowRemoteActivation);
-    }
+		TryActivateComboAbility(AbilityClass, bAllowRemoteActivation);
+	}
 }
 
 void UGSCComboManagerComponent::CacheIsNetSimulated()
@@ -174,6 +349,13 @@ void UGSCComboManagerComponent::CacheIsNetSimulated()
 
 void UGSCComboManagerComponent::ServerSetComboIndex_Implementation(const int32 InComboIndex)
 {
+	if (bPredictComboAdvancement)
+	{
+		// Owning client already has it, and simulated proxies don't need it
+		ComboIndex = InComboIndex;
+		return;
+	}
+
 	MulticastSetComboIndex(InComboIndex);
 }
 
@@ -185,6 +367,25 @@ void UGSCComboManagerComponent::MulticastSetComboIndex_Implementation(const int3
 	}
 }
 
+void UGSCComboManagerComponent::ClientCorrectComboIndex_Implementation(const int32 InComboIndex)
+{
+	ComboIndex = InComboIndex;
+}
+
+void UGSCComboManagerComponent::OnRep_ReplicatedComboState()
+{
+	SetComboState(ReplicatedComboState);
+}
+
+void UGSCComboManagerComponent::OnComboPredictionRejected(const int32 PreviousComboIndex, const int32 PredictedComboIndex)
+{
+	GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::OnComboPredictionRejected() %s combo index %d rejected"), *GetNameSafe(GetOwner()), PredictedComboIndex)
+	if (ComboIndex == PredictedComboIndex)
+	{
+		ComboIndex = PreviousComboIndex;
+	}
+}
+
 void UGSCComboManagerComponent::MulticastActivateComboAbility_Implementation(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
 {
     if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
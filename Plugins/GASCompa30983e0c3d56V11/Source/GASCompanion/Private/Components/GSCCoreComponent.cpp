@@ -5,20 +5,70 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "Abilities/Attributes/GSCAttributeSet.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tracked Effect Handles"), STAT_GSC_TrackedEffectHandles, STATGROUP_GASCompanion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pruned Effect Handles"), STAT_GSC_PrunedEffectHandles, STATGROUP_GASCompanion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Untracked Effect Handles (over cap)"), STAT_GSC_UntrackedEffectHandles, STATGROUP_GASCompanion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Coalesced Attribute Changes"), STAT_GSC_CoalescedAttributeChanges, STATGROUP_GASCompanion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cancelled Coalesced Attribute Changes"), STAT_GSC_CancelledAttributeChanges, STATGROUP_GASCompanion);
 
 // Sets default values for this component's properties
 UGSCCoreComponent::UGSCCoreComponent()
 {
 	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
 	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
 	SetIsReplicatedByDefault(true);
 }
 
+void UGSCCoreComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Tick is only enabled while coalesced attribute changes are pending
+	SetTickGroup(CoalescingTickGroup);
+
+	// Let owner ASC know its avatar component cache needs to pick us up
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+}
+
+void UGSCCoreComponent::OnUnregister()
+{
+	UGSCBlueprintFunctionLibrary::InvalidateCompanionComponentCache(GetOwner());
+
+	Super::OnUnregister();
+}
+
+void UGSCCoreComponent::TickComponent(const float DeltaTime, const ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	BindAttributeChangeDelegatesIfListened();
+	FlushCoalescedAttributeChanges();
+
+	if (CooldownTracker.Num() > 0)
+	{
+		CooldownTracker.Advance(GetWorld()->GetTimeSeconds(), [this](const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, const float Duration)
+		{
+			OnCooldownExpired(AbilitySpecHandle, CooldownTags, Duration);
+		});
+	}
+
+	// Listeners may have changed attributes again while broadcasting, keep ticking to broadcast them next frame
+	if (!HasPendingAttributeChanges() && CooldownTracker.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
 // Called when the game starts
 void UGSCCoreComponent::BeginPlay()
 {
@@ -67,19 +117,11 @@ void UGSCCoreComponent::RegisterAbilitySystemDelegates(UAbilitySystemComponent*
 	// Make sure to shut down delegates previously registered, if RegisterAbilitySystemDelegates is called more than once (likely from AbilityActorInfo)
 	ShutdownAbilitySystemDelegates(ASC);
 
-	TArray<FGameplayAttribute> Attributes;
-	ASC->GetAllAttributes(Attributes);
-
-	for (FGameplayAttribute Attribute : Attributes)
+	BindAttributeChangeDelegates(ASC);
+	if (AttributeSubscription == EGSCAttributeSubscription::WhenListened && BoundAttributes.Num() == 0)
 	{
-		if (Attribute == UGSCAttributeSet::GetDamageAttribute() || Attribute == UGSCAttributeSet::GetStaminaDamageAttribute())
-		{
-			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnDamageAttributeChanged);
-		}
-		else
-		{
-			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnAttributeChanged);
-		}
+		// Listeners are usually bound from BeginPlay, after the ability system got initialized. Check again next frame.
+		RequestComponentTick();
 	}
 
 	// Handle GameplayEffects added / remove
@@ -91,6 +133,20 @@ void UGSCCoreComponent::RegisterAbilitySystemDelegates(UAbilitySystemComponent*
 
 	// Handle Ability Commit events
 	ASC->AbilityCommittedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityCommitted);
+
+	// Keep track of active ability instances
+	ResetActiveAbilityIndex(ASC);
+	ASC->AbilityActivatedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityActivatedForIndex);
+	ASC->AbilityEndedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityEndedForIndex);
+
+	// Saves attribute sets a component lookup on each attribute change and effect execution
+	for (UAttributeSet* AttributeSet : ASC->GetSpawnedAttributes())
+	{
+		if (UGSCAttributeSetBase* CompanionAttributeSet = Cast<UGSCAttributeSetBase>(AttributeSet))
+		{
+			CompanionAttributeSet->SetOwnerCoreComponent(this);
+		}
+	}
 }
 
 void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent* ASC)
@@ -102,18 +158,25 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 		return;
 	}
 
-	TArray<FGameplayAttribute> Attributes;
-	ASC->GetAllAttributes(Attributes);
-
-	for (const FGameplayAttribute& Attribute : Attributes)
-	{
-		ASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
-	}
+	UnbindAttributeChangeDelegates(ASC);
 
 	ASC->OnActiveGameplayEffectAddedDelegateToSelf.RemoveAll(this);
 	ASC->OnAnyGameplayEffectRemovedDelegate().RemoveAll(this);
 	ASC->RegisterGenericGameplayTagEvent().RemoveAll(this);
 	ASC->AbilityCommittedCallbacks.RemoveAll(this);
+	ASC->AbilityActivatedCallbacks.RemoveAll(this);
+	ASC->AbilityEndedCallbacks.RemoveAll(this);
+
+	for (UAttributeSet* AttributeSet : ASC->GetSpawnedAttributes())
+	{
+		if (UGSCAttributeSetBase* CompanionAttributeSet = Cast<UGSCAttributeSetBase>(AttributeSet))
+		{
+			CompanionAttributeSet->SetOwnerCoreComponent(nullptr);
+		}
+	}
+
+	ResetActiveAbilityIndex(nullptr);
+	CooldownTracker.Reset();
 
 	for (const FActiveGameplayEffectHandle GameplayEffectAddedHandle : GameplayEffectAddedHandles)
 	{
@@ -133,12 +196,94 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 		}
 	}
 
+	DEC_DWORD_STAT_BY(STAT_GSC_TrackedEffectHandles, GameplayEffectAddedHandles.Num());
+	GameplayEffectAddedHandles.Reset();
+
 	for (const FGameplayTag GameplayTagBoundToDelegate : GameplayTagBoundToDelegates)
 	{
 		ASC->RegisterGameplayTagEvent(GameplayTagBoundToDelegate).RemoveAll(this);
 	}
 }
 
+void UGSCCoreComponent::RefreshAttributeSubscriptions()
+{
+	if (!OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	UnbindAttributeChangeDelegates(OwnerAbilitySystemComponent);
+	BindAttributeChangeDelegates(OwnerAbilitySystemComponent);
+}
+
+void UGSCCoreComponent::BindAttributeChangeDelegatesIfListened()
+{
+	if (AttributeSubscription != EGSCAttributeSubscription::WhenListened || BoundAttributes.Num() > 0 || !OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	if (OnAttributeChange.IsBound() || OnCoalescedAttributeChange.IsBound())
+	{
+		BindAttributeChangeDelegates(OwnerAbilitySystemComponent);
+	}
+}
+
+void UGSCCoreComponent::BindAttributeChangeDelegates(UAbilitySystemComponent* ASC)
+{
+	check(ASC);
+
+	if (AttributeSubscription == EGSCAttributeSubscription::WhenListened && !OnAttributeChange.IsBound() && !OnCoalescedAttributeChange.IsBound())
+	{
+		GSC_WLOG(Verbose, TEXT("OnAttributeChange has no listener, skip binding attributes of %s"), *GetNameSafe(ASC))
+		return;
+	}
+
+	TArray<FGameplayAttribute> Attributes;
+	ASC->GetAllAttributes(Attributes);
+
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		const bool bIsDamageAttribute = Attribute == UGSCAttributeSet::GetDamageAttribute() || Attribute == UGSCAttributeSet::GetStaminaDamageAttribute();
+		if (AttributeSubscription == EGSCAttributeSubscription::SubscribedAttributes)
+		{
+			// Meta damage attributes don't broadcast anything, only bind explicitly subscribed regular attributes
+			if (bIsDamageAttribute || !SubscribedAttributes.Contains(Attribute))
+			{
+				continue;
+			}
+		}
+
+		if (bIsDamageAttribute)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnDamageAttributeChanged);
+		}
+		else
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCCoreComponent::OnAttributeChanged);
+		}
+
+		BoundAttributes.Add(Attribute);
+	}
+
+	GSC_WLOG(Verbose, TEXT("Bound %d out of %d attributes for %s"), BoundAttributes.Num(), Attributes.Num(), *GetNameSafe(ASC))
+}
+
+void UGSCCoreComponent::UnbindAttributeChangeDelegates(UAbilitySystemComponent* ASC)
+{
+	check(ASC);
+
+	TArray<FGameplayAttribute> Attributes;
+	ASC->GetAllAttributes(Attributes);
+
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+	}
+
+	BoundAttributes.Reset();
+}
+
 void UGSCCoreComponent::HandleDamage(const float DamageAmount, const FGameplayTagContainer& DamageTags, AActor* SourceActor)
 {
 	OnDamage.Broadcast(DamageAmount, SourceActor, DamageTags);
@@ -156,6 +301,13 @@ void UGSCCoreComponent::HandleHealthChange(const float DeltaValue, const FGamepl
 		return;
 	}
 
+	if (bCoalesceAttributeChanges)
+	{
+		PendingHealthChange.Merge(0.f, 0.f, DeltaValue, EventTags);
+		RequestComponentTick();
+		return;
+	}
+
 	OnHealthChange.Broadcast(DeltaValue, EventTags);
 	if (!IsAlive())
 	{
@@ -171,6 +323,13 @@ void UGSCCoreComponent::HandleStaminaChange(const float DeltaValue, const FGamep
 		return;
 	}
 
+	if (bCoalesceAttributeChanges)
+	{
+		PendingStaminaChange.Merge(0.f, 0.f, DeltaValue, EventTags);
+		RequestComponentTick();
+		return;
+	}
+
 	OnStaminaChange.Broadcast(DeltaValue, EventTags);
 }
 
@@ -182,11 +341,25 @@ void UGSCCoreComponent::HandleManaChange(const float DeltaValue, const FGameplay
 		return;
 	}
 
+	if (bCoalesceAttributeChanges)
+	{
+		PendingManaChange.Merge(0.f, 0.f, DeltaValue, EventTags);
+		RequestComponentTick();
+		return;
+	}
+
 	OnManaChange.Broadcast(DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::HandleAttributeChange(const FGameplayAttribute Attribute, const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
+	if (bCoalesceAttributeChanges)
+	{
+		PendingHandledAttributeChanges.FindOrAdd(Attribute).Merge(0.f, 0.f, DeltaValue, EventTags);
+		RequestComponentTick();
+		return;
+	}
+
 	OnAttributeChange.Broadcast(Attribute, DeltaValue, EventTags);
 }
 
@@ -209,8 +382,97 @@ void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 		SourceTags = *ModData->EffectSpec.CapturedSourceTags.GetAggregatedTags();
 	}
 
+	if (bCoalesceAttributeChanges)
+	{
+		PendingAttributeChanges.FindOrAdd(Data.Attribute).Merge(OldValue, NewValue, NewValue - OldValue, SourceTags);
+		RequestComponentTick();
+		return;
+	}
+
 	// Broadcast attribute change to component
 	OnAttributeChange.Broadcast(Data.Attribute, NewValue - OldValue, SourceTags);
+	OnCoalescedAttributeChange.Broadcast(Data.Attribute, OldValue, NewValue, 1);
+}
+
+void UGSCCoreComponent::FlushCoalescedAttributeChanges()
+{
+	// Changes made by listeners while flushing are collected in pending maps again, and broadcast on next flush
+	if (bFlushingAttributeChanges)
+	{
+		return;
+	}
+
+	TGuardValue<bool> FlushingGuard(bFlushingAttributeChanges, true);
+
+	Swap(PendingAttributeChanges, FlushingAttributeChanges);
+	Swap(PendingHandledAttributeChanges, FlushingHandledAttributeChanges);
+
+	for (const TPair<FGameplayAttribute, FGSCCoalescedAttributeChange>& Pair : FlushingAttributeChanges)
+	{
+		const FGSCCoalescedAttributeChange& Change = Pair.Value;
+		INC_DWORD_STAT_BY(STAT_GSC_CoalescedAttributeChanges, Change.NumChanges);
+
+		if (!Change.HasValueChanged())
+		{
+			INC_DWORD_STAT(STAT_GSC_CancelledAttributeChanges);
+			continue;
+		}
+
+		OnAttributeChange.Broadcast(Pair.Key, Change.NewValue - Change.OldValue, Change.EventTags);
+		OnCoalescedAttributeChange.Broadcast(Pair.Key, Change.OldValue, Change.NewValue, Change.NumChanges);
+	}
+
+	for (const TPair<FGameplayAttribute, FGSCCoalescedAttributeChange>& Pair : FlushingHandledAttributeChanges)
+	{
+		OnAttributeChange.Broadcast(Pair.Key, Pair.Value.DeltaValue, Pair.Value.EventTags);
+	}
+
+	// Keep allocations around for next frame
+	FlushingAttributeChanges.Reset();
+	FlushingHandledAttributeChanges.Reset();
+
+	if (PendingHealthChange.IsPending())
+	{
+		const FGSCCoalescedAttributeChange Change = MoveTemp(PendingHealthChange);
+		PendingHealthChange.Reset();
+
+		OnHealthChange.Broadcast(Change.DeltaValue, Change.EventTags);
+		if (!IsAlive())
+		{
+			Die();
+		}
+	}
+
+	if (PendingStaminaChange.IsPending())
+	{
+		const FGSCCoalescedAttributeChange Change = MoveTemp(PendingStaminaChange);
+		PendingStaminaChange.Reset();
+		OnStaminaChange.Broadcast(Change.DeltaValue, Change.EventTags);
+	}
+
+	if (PendingManaChange.IsPending())
+	{
+		const FGSCCoalescedAttributeChange Change = MoveTemp(PendingManaChange);
+		PendingManaChange.Reset();
+		OnManaChange.Broadcast(Change.DeltaValue, Change.EventTags);
+	}
+}
+
+void UGSCCoreComponent::RequestComponentTick()
+{
+	if (!IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+bool UGSCCoreComponent::HasPendingAttributeChanges() const
+{
+	return PendingAttributeChanges.Num() > 0
+		|| PendingHandledAttributeChanges.Num() > 0
+		|| PendingHealthChange.IsPending()
+		|| PendingStaminaChange.IsPending()
+		|| PendingManaChange.IsPending();
 }
 
 void UGSCCoreComponent::OnDamageAttributeChanged(const FOnAttributeChangeData& Data)
@@ -431,7 +693,7 @@ bool UGSCCoreComponent::IsUsingAbilityByClass(const TSubclassOf<UGameplayAbility
 		return false;
 	}
 
-	return GetActiveAbilitiesByClass(AbilityClass).Num() > 0;
+	return GetFirstActiveAbilityByClass(AbilityClass) != nullptr;
 }
 
 bool UGSCCoreComponent::IsUsingAbilityByTags(const FGameplayTagContainer AbilityTags)
@@ -442,7 +704,14 @@ bool UGSCCoreComponent::IsUsingAbilityByTags(const FGameplayTagContainer Ability
 		return false;
 	}
 
-	return GetActiveAbilitiesByTags(AbilityTags).Num() > 0;
+	bool bIsUsingAbility = false;
+	ForEachActiveAbilityByTags(AbilityTags, [&bIsUsingAbility](UGameplayAbility*)
+	{
+		bIsUsingAbility = true;
+		return false;
+	});
+
+	return bIsUsingAbility;
 }
 
 TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByClass(TSubclassOf<UGameplayAbility> AbilityToSearch) const
@@ -453,33 +722,12 @@ TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByClass(TSubclass
 		return {};
 	}
 
-	TArray<FGameplayAbilitySpec> Specs = OwnerAbilitySystemComponent->GetActivatableAbilities();
-	TArray<struct FGameplayAbilitySpec*> MatchingGameplayAbilities;
 	TArray<UGameplayAbility*> ActiveAbilities;
-
-	// First, search for matching Abilities for this class
-	for (const FGameplayAbilitySpec& Spec : Specs)
-	{
-		if (Spec.Ability && Spec.Ability->GetClass()->IsChildOf(AbilityToSearch))
-		{
-			MatchingGameplayAbilities.Add(const_cast<FGameplayAbilitySpec*>(&Spec));
-		}
-	}
-
-	// Iterate the list of all ability specs
-	for (const FGameplayAbilitySpec* Spec : MatchingGameplayAbilities)
+	ForEachActiveAbilityByClass(AbilityToSearch, [&ActiveAbilities](UGameplayAbility* ActiveAbility)
 	{
-		// Iterate all instances on this ability spec, which can include instance per execution abilities
-		TArray<UGameplayAbility*> AbilityInstances = Spec->GetAbilityInstances();
-
-		for (UGameplayAbility* ActiveAbility : AbilityInstances)
-		{
-			if (ActiveAbility->IsActive())
-			{
-				ActiveAbilities.Add(ActiveAbility);
-			}
-		}
-	}
+		ActiveAbilities.Add(ActiveAbility);
+		return true;
+	});
 
 	return ActiveAbilities;
 }
@@ -493,25 +741,52 @@ TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByTags(const FGam
 	}
 
 	TArray<UGameplayAbility*> ActiveAbilities;
-	TArray<FGameplayAbilitySpec*> MatchingGameplayAbilities;
-	OwnerAbilitySystemComponent->GetActivatableGameplayAbilitySpecsByAllMatchingTags(GameplayTagContainer, MatchingGameplayAbilities, false);
+	ForEachActiveAbilityByTags(GameplayTagContainer, [&ActiveAbilities](UGameplayAbility* ActiveAbility)
+	{
+		ActiveAbilities.Add(ActiveAbility);
+		return true;
+	});
+
+	return ActiveAbilities;
+}
 
-	// Iterate the list of all ability specs
-	for (const FGameplayAbilitySpec* Spec : MatchingGameplayAbilities)
+void UGSCCoreComponent::ForEachActiveAbilityByClass(const TSubclassOf<UGameplayAbility> AbilityClass, const TFunctionRef<bool(UGameplayAbility*)> Visitor) const
+{
+	const UClass* SearchClass = AbilityClass.Get();
+	if (!SearchClass)
 	{
-		// Iterate all instances on this ability spec
-		TArray<UGameplayAbility*> AbilityInstances = Spec->GetAbilityInstances();
+		return;
+	}
 
-		for (UGameplayAbility* ActiveAbility : AbilityInstances)
-		{
-			if (ActiveAbility->IsActive())
-			{
-				ActiveAbilities.Add(ActiveAbility);
-			}
-		}
+	VisitActiveAbilities([SearchClass](const UClass* ActiveClass) { return ActiveClass->IsChildOf(SearchClass); }, Visitor);
+}
+
+void UGSCCoreComponent::ForEachActiveAbilityByTags(const FGameplayTagContainer& GameplayTagContainer, const TFunctionRef<bool(UGameplayAbility*)> Visitor) const
+{
+	// HasAll() is true for an empty container, which would match every ability. The engine query matched none.
+	if (!GameplayTagContainer.IsValid())
+	{
+		return;
 	}
 
-	return ActiveAbilities;;
+	// Asset tags are class defaults, so filter on the class CDO once rather than on each instance
+	VisitActiveAbilities([&GameplayTagContainer](const UClass* ActiveClass)
+	{
+		const UGameplayAbility* AbilityCDO = ActiveClass->GetDefaultObject<UGameplayAbility>();
+		return AbilityCDO && AbilityCDO->GetAssetTags().HasAll(GameplayTagContainer);
+	}, Visitor);
+}
+
+UGameplayAbility* UGSCCoreComponent::GetFirstActiveAbilityByClass(const TSubclassOf<UGameplayAbility> AbilityClass) const
+{
+	UGameplayAbility* FoundAbility = nullptr;
+	ForEachActiveAbilityByClass(AbilityClass, [&FoundAbility](UGameplayAbility* ActiveAbility)
+	{
+		FoundAbility = ActiveAbility;
+		return false;
+	});
+
+	return FoundAbility;
 }
 
 bool UGSCCoreComponent::ActivateAbilityByClass(const TSubclassOf<UGameplayAbility> AbilityClass, UGSCGameplayAbility*& ActivatedAbility, const bool bAllowRemoteActivation)
@@ -523,15 +798,15 @@ bool UGSCCoreComponent::ActivateAbilityByClass(const TSubclassOf<UGameplayAbilit
 
 	const bool bSuccess = OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityClass, bAllowRemoteActivation);
 
-	TArray<UGameplayAbility*> ActiveAbilities = GetActiveAbilitiesByClass(AbilityClass);
-	if (ActiveAbilities.Num() == 0)
+	UGameplayAbility* ActiveAbility = GetFirstActiveAbilityByClass(AbilityClass);
+	if (!ActiveAbility)
 	{
 		GSC_LOG(Verbose, TEXT("UGSCCoreComponent::ActivateAbilityByClass Couldn't get back active abilities with Class %s. Won't be able to return ActivatedAbility instance."), *AbilityClass->GetName());
 	}
 
-	if (bSuccess && ActiveAbilities.Num() > 0)
+	if (bSuccess && ActiveAbility)
 	{
-		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbilities[0]);
+		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbility);
 		if (GSCAbility)
 		{
 			ActivatedAbility = GSCAbility;
@@ -560,19 +835,21 @@ bool UGSCCoreComponent::ActivateAbilityByTags(const FGameplayTagContainer Abilit
 	}
 
 	const FGameplayAbilitySpec* Spec = AbilitiesToActivate[FMath::RandRange(0, Count - 1)];
+	const TSubclassOf<UGameplayAbility> AbilityClass = Spec->Ability ? Spec->Ability->GetClass() : nullptr;
 
 	// actually trigger the ability
 	const bool bSuccess = OwnerAbilitySystemComponent->TryActivateAbility(Spec->Handle, bAllowRemoteActivation);
 
-	TArray<UGameplayAbility*> ActiveAbilities = GetActiveAbilitiesByTags(AbilityTags);
-	if (ActiveAbilities.Num() == 0)
+	// Look up the instance of the spec we just activated, instead of searching all specs matching the tags again
+	UGameplayAbility* ActiveAbility = GetFirstActiveAbilityByClass(AbilityClass);
+	if (!ActiveAbility)
 	{
 		GSC_LOG(Warning, TEXT("UGSCCoreComponent::ActivateAbilityByTags Couldn't get back active abilities with tags %s"), *AbilityTags.ToStringSimple());
 	}
 
-	if (bSuccess && ActiveAbilities.Num() > 0)
+	if (bSuccess && ActiveAbility)
 	{
-		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbilities[0]);
+		UGSCGameplayAbility* GSCAbility = Cast<UGSCGameplayAbility>(ActiveAbility);
 		if (GSCAbility)
 		{
 			ActivatedAbility = GSCAbility;
@@ -627,6 +904,9 @@ void UGSCCoreComponent::AdjustAttributeForMaxChange(UGSCAttributeSetBase* Attrib
 
 void UGSCCoreComponent::PreAttributeChange(UGSCAttributeSetBase* AttributeSet, const FGameplayAttribute& Attribute, const float NewValue)
 {
+	// Attribute delegates are broadcast after this, a listener bound since registration still gets this change
+	BindAttributeChangeDelegatesIfListened();
+
 	OnPreAttributeChange.Broadcast(AttributeSet, Attribute, NewValue);
 }
 
@@ -638,6 +918,12 @@ void UGSCCoreComponent::PostGameplayEffectExecute(UGSCAttributeSetBase* Attribut
 		return;
 	}
 
+	// Nothing to build the payload for
+	if (!OnPostGameplayEffectExecute.IsBound())
+	{
+		return;
+	}
+
 	AActor* SourceActor = nullptr;
 	AActor* TargetActor = nullptr;
 	AttributeSet->GetSourceAndTargetFromContext<AActor>(Data, SourceActor, TargetActor);
@@ -677,6 +963,9 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 		return;
 	}
 
+	// Periodic effects only change attributes once added, catch up with listeners bound since registration
+	BindAttributeChangeDelegatesIfListened();
+
 	FGameplayTagContainer AssetTags;
 	SpecApplied.GetAllAssetTags(AssetTags);
 
@@ -685,6 +974,12 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 
 	OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
 
+	// Store active handles to clear out bound delegates when shutting down listeners
+	if (!TrackGameplayEffectHandle(ActiveHandle))
+	{
+		return;
+	}
+
 	if (FOnActiveGameplayEffectStackChange* Delegate = OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle))
 	{
 		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
@@ -694,9 +989,56 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 	{
 		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectTimeChanged);
 	}
+}
 
-	// Store active handles to clear out bound delegates when shutting down listeners
-	GameplayEffectAddedHandles.AddUnique(ActiveHandle);
+bool UGSCCoreComponent::TrackGameplayEffectHandle(const FActiveGameplayEffectHandle ActiveHandle)
+{
+	if (MaxTrackedGameplayEffectHandles > 0 && GameplayEffectAddedHandles.Num() >= MaxTrackedGameplayEffectHandles)
+	{
+		PruneGameplayEffectHandles();
+
+		if (GameplayEffectAddedHandles.Num() >= MaxTrackedGameplayEffectHandles)
+		{
+			if (!bWarnedTrackedGameplayEffectHandlesCap)
+			{
+				GSC_WLOG(Warning, TEXT("Reached MaxTrackedGameplayEffectHandles (%d) for %s, stack and time change events won't be broadcast for additional effects"), MaxTrackedGameplayEffectHandles, *GetNameSafe(GetOwner()))
+				bWarnedTrackedGameplayEffectHandlesCap = true;
+			}
+
+			INC_DWORD_STAT(STAT_GSC_UntrackedEffectHandles);
+			return false;
+		}
+	}
+
+	bool bAlreadyTracked = false;
+	GameplayEffectAddedHandles.Add(ActiveHandle, &bAlreadyTracked);
+	if (!bAlreadyTracked)
+	{
+		INC_DWORD_STAT(STAT_GSC_TrackedEffectHandles);
+	}
+
+	return true;
+}
+
+void UGSCCoreComponent::PruneGameplayEffectHandles()
+{
+	if (!OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	int32 NumPruned = 0;
+	for (TSet<FActiveGameplayEffectHandle>::TIterator It(GameplayEffectAddedHandles); It; ++It)
+	{
+		if (!OwnerAbilitySystemComponent->GetActiveGameplayEffect(*It))
+		{
+			It.RemoveCurrent();
+			++NumPruned;
+		}
+	}
+
+	DEC_DWORD_STAT_BY(STAT_GSC_TrackedEffectHandles, NumPruned);
+	INC_DWORD_STAT_BY(STAT_GSC_PrunedEffectHandles, NumPruned);
 }
 
 void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplayEffectHandle ActiveHandle, const int32 NewStackCount, const int32 PreviousStackCount)
@@ -745,6 +1087,12 @@ void UGSCCoreComponent::OnActiveGameplayEffectTimeChanged(const FActiveGameplayE
 
 void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect& EffectRemoved)
 {
+	// Delegates bound to the effect go away with it
+	if (GameplayEffectAddedHandles.Remove(EffectRemoved.Handle) > 0)
+	{
+		DEC_DWORD_STAT(STAT_GSC_TrackedEffectHandles);
+	}
+
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -758,6 +1106,23 @@ void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect&
 
 	OnGameplayEffectStackChange.Broadcast(AssetTags, GrantedTags, EffectRemoved.Handle, 0, 1);
 	OnGameplayEffectRemoved.Broadcast(AssetTags, GrantedTags, EffectRemoved.Handle);
+
+	// A cooldown effect removed before its expiration (cleared or reduced cooldown), end tracked cooldowns right away if they're over
+	TArray<FGameplayAbilitySpecHandle> CooldownHandles;
+	CooldownTracker.GetCooldownsWithAnyTag(GrantedTags, CooldownHandles);
+	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : CooldownHandles)
+	{
+		float Duration = 0.f;
+		if (GetAbilityCooldownTimeRemaining(AbilitySpecHandle, Duration) > 0.f)
+		{
+			continue;
+		}
+
+		CooldownTracker.Expire(AbilitySpecHandle, [this](const FGameplayAbilitySpecHandle& ExpiredHandle, const FGameplayTagContainer& CooldownTags, const float ExpiredDuration)
+		{
+			OnCooldownExpired(ExpiredHandle, CooldownTags, ExpiredDuration);
+		});
+	}
 }
 
 void UGSCCoreComponent::OnAnyGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount) const
@@ -848,7 +1213,16 @@ void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* Activate
 
 	OnCooldownStart.Broadcast(ActivatedAbility, *CooldownTags, TimeRemaining, Duration);
 
-	// Register delegate to monitor any change to cooldown gameplay tag to be able to figure out when a cooldown expires
+	// Track cooldown expiration on the timer wheel, instead of registering a gameplay tag event per cooldown tag
+	const UWorld* World = GetWorld();
+	if (TimeRemaining > 0.f && World)
+	{
+		CooldownTracker.Start(AbilitySpecHandle, *CooldownTags, World->GetTimeSeconds(), TimeRemaining, Duration);
+		RequestComponentTick();
+		return;
+	}
+
+	// Cooldowns without a known end (infinite duration) are still monitored from cooldown gameplay tag removal
 	TArray<FGameplayTag> GameplayTags;
 	CooldownTags->GetGameplayTagArray(GameplayTags);
 	for (const FGameplayTag GameplayTag : GameplayTags)
@@ -859,3 +1233,255 @@ void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* Activate
 		GameplayTagBoundToDelegates.AddUnique(GameplayTag);
 	}
 }
+
+void UGSCCoreComponent::OnCooldownExpired(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, const float Duration)
+{
+	if (!OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	const FGameplayAbilitySpec* AbilitySpec = OwnerAbilitySystemComponent->FindAbilitySpecFromHandle(AbilitySpecHandle);
+	if (!AbilitySpec)
+	{
+		// Ability might have been cleared when cooldown expires
+		return;
+	}
+
+	// Cooldown may have been extended since it started
+	float NewDuration = 0.f;
+	const float TimeRemaining = GetAbilityCooldownTimeRemaining(AbilitySpecHandle, NewDuration);
+	if (TimeRemaining > 0.f && GetWorld())
+	{
+		CooldownTracker.Start(AbilitySpecHandle, CooldownTags, GetWorld()->GetTimeSeconds(), TimeRemaining, NewDuration);
+		RequestComponentTick();
+		return;
+	}
+
+	UGameplayAbility* Ability = AbilitySpec->Ability;
+
+	// Broadcast cooldown expiration to BP
+	if (IsValid(Ability))
+	{
+		for (const FGameplayTag& GameplayTag : CooldownTags)
+		{
+			OnCooldownEnd.Broadcast(Ability, GameplayTag, Duration);
+		}
+	}
+}
+
+float UGSCCoreComponent::GetAbilityCooldownTimeRemaining(const FGameplayAbilitySpecHandle& AbilitySpecHandle, float& OutDuration) const
+{
+	OutDuration = 0.f;
+
+	if (!OwnerAbilitySystemComponent)
+	{
+		return 0.f;
+	}
+
+	const FGameplayAbilitySpec* AbilitySpec = OwnerAbilitySystemComponent->FindAbilitySpecFromHandle(AbilitySpecHandle);
+	if (!AbilitySpec)
+	{
+		return 0.f;
+	}
+
+	// Prefer the instance, cooldown tags might depend on its state
+	const UGameplayAbility* Ability = AbilitySpec->GetPrimaryInstance() ? AbilitySpec->GetPrimaryInstance() : AbilitySpec->Ability.Get();
+	if (!Ability)
+	{
+		return 0.f;
+	}
+
+	float TimeRemaining = 0.f;
+	Ability->GetCooldownTimeRemainingAndDuration(AbilitySpecHandle, OwnerAbilitySystemComponent->AbilityActorInfo.Get(), TimeRemaining, OutDuration);
+	return TimeRemaining;
+}
+
+float UGSCCoreComponent::GetCooldownTimeRemaining(const FGameplayAbilitySpecHandle AbilitySpecHandle) const
+{
+	const UWorld* World = GetWorld();
+	return World ? CooldownTracker.GetTimeRemaining(AbilitySpecHandle, World->GetTimeSeconds()) : 0.f;
+}
+
+float UGSCCoreComponent::GetCooldownRemainingFraction(const FGameplayAbilitySpecHandle AbilitySpecHandle) const
+{
+	const UWorld* World = GetWorld();
+	return World ? CooldownTracker.GetRemainingFraction(AbilitySpecHandle, World->GetTimeSeconds()) : 0.f;
+}
+
+void UGSCCoreComponent::OnAbilityActivatedForIndex(UGameplayAbility* Ability)
+{
+	// Only instances can be tracked (and queried back), same as FGameplayAbilitySpec::GetAbilityInstances()
+	if (!Ability || !Ability->IsInstantiated())
+	{
+		return;
+	}
+
+	if (ActiveAbilityIndexVisitDepth > 0)
+	{
+		PendingActiveAbilities.AddUnique(Ability);
+		return;
+	}
+
+	ActiveAbilityIndex.FindOrAdd(TObjectKey<UClass>(Ability->GetClass())).AddUnique(Ability);
+}
+
+void UGSCCoreComponent::OnAbilityEndedForIndex(UGameplayAbility* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	PendingActiveAbilities.RemoveSingleSwap(Ability);
+
+	const TObjectKey<UClass> ClassKey(Ability->GetClass());
+	TArray<TWeakObjectPtr<UGameplayAbility>, TInlineAllocator<2>>* Instances = ActiveAbilityIndex.Find(ClassKey);
+	if (!Instances)
+	{
+		return;
+	}
+
+	if (ActiveAbilityIndexVisitDepth > 0)
+	{
+		// Visitor may be iterating this very array, only clear the slot and compact once done
+		const int32 Index = Instances->IndexOfByKey(Ability);
+		if (Index != INDEX_NONE)
+		{
+			(*Instances)[Index].Reset();
+			bActiveAbilityIndexNeedsCompaction = true;
+		}
+		return;
+	}
+
+	Instances->RemoveSingleSwap(Ability);
+	if (Instances->IsEmpty())
+	{
+		ActiveAbilityIndex.Remove(ClassKey);
+	}
+}
+
+void UGSCCoreComponent::ResetActiveAbilityIndex(const UAbilitySystemComponent* ASC)
+{
+	ActiveAbilityIndex.Reset();
+	PendingActiveAbilities.Reset();
+	bActiveAbilityIndexNeedsCompaction = false;
+	ActiveAbilityIndexASC = ASC;
+
+	if (!ASC)
+	{
+		return;
+	}
+
+	// Pick up abilities that were already running before we started listening to activation callbacks
+	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+	{
+		if (!Spec.IsActive())
+		{
+			continue;
+		}
+
+		for (UGameplayAbility* AbilityInstance : Spec.GetAbilityInstances())
+		{
+			if (AbilityInstance && AbilityInstance->IsActive())
+			{
+				OnAbilityActivatedForIndex(AbilityInstance);
+			}
+		}
+	}
+}
+
+void UGSCCoreComponent::VisitActiveAbilities(const TFunctionRef<bool(const UClass*)> ClassFilter, const TFunctionRef<bool(UGameplayAbility*)> Visitor) const
+{
+	if (!OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	if (ActiveAbilityIndexASC.Get() == OwnerAbilitySystemComponent.Get())
+	{
+		VisitActiveAbilityIndex(ClassFilter, Visitor);
+		return;
+	}
+
+	// Index isn't maintained for this ASC, scan its specs. Lock the list as Visitor may give or clear abilities.
+	FScopedAbilityListLock ActiveScopeLock(*OwnerAbilitySystemComponent);
+	for (const FGameplayAbilitySpec& Spec : OwnerAbilitySystemComponent->GetActivatableAbilities())
+	{
+		if (!Spec.Ability || !ClassFilter(Spec.Ability->GetClass()))
+		{
+			continue;
+		}
+
+		for (UGameplayAbility* AbilityInstance : Spec.GetAbilityInstances())
+		{
+			if (AbilityInstance && AbilityInstance->IsActive() && !Visitor(AbilityInstance))
+			{
+				return;
+			}
+		}
+	}
+}
+
+void UGSCCoreComponent::VisitActiveAbilityIndex(const TFunctionRef<bool(const UClass*)> ClassFilter, const TFunctionRef<bool(UGameplayAbility*)> Visitor) const
+{
+	++ActiveAbilityIndexVisitDepth;
+
+	for (const TPair<TObjectKey<UClass>, TArray<TWeakObjectPtr<UGameplayAbility>, TInlineAllocator<2>>>& Entry : ActiveAbilityIndex)
+	{
+		const UClass* ActiveClass = Entry.Key.ResolveObjectPtr();
+		if (!ActiveClass || !ClassFilter(ActiveClass))
+		{
+			continue;
+		}
+
+		bool bContinue = true;
+		for (const TWeakObjectPtr<UGameplayAbility>& WeakAbility : Entry.Value)
+		{
+			UGameplayAbility* ActiveAbility = WeakAbility.Get();
+			if (ActiveAbility && ActiveAbility->IsActive() && !Visitor(ActiveAbility))
+			{
+				bContinue = false;
+				break;
+			}
+		}
+
+		if (!bContinue)
+		{
+			break;
+		}
+	}
+
+	--ActiveAbilityIndexVisitDepth;
+	if (ActiveAbilityIndexVisitDepth == 0)
+	{
+		FlushActiveAbilityIndex();
+	}
+}
+
+void UGSCCoreComponent::FlushActiveAbilityIndex() const
+{
+	for (const TWeakObjectPtr<UGameplayAbility>& WeakAbility : PendingActiveAbilities)
+	{
+		UGameplayAbility* ActiveAbility = WeakAbility.Get();
+		if (ActiveAbility && ActiveAbility->IsActive())
+		{
+			ActiveAbilityIndex.FindOrAdd(TObjectKey<UClass>(ActiveAbility->GetClass())).AddUnique(WeakAbility);
+		}
+	}
+	PendingActiveAbilities.Reset();
+
+	if (bActiveAbilityIndexNeedsCompaction)
+	{
+		for (auto It = ActiveAbilityIndex.CreateIterator(); It; ++It)
+		{
+			It.Value().RemoveAllSwap([](const TWeakObjectPtr<UGameplayAbility>& WeakAbility) { return !WeakAbility.IsValid(); });
+			if (It.Value().IsEmpty())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		bActiveAbilityIndexNeedsCompaction = false;
+	}
+}
@@ -7,6 +7,7 @@
 #include "GSCLog.h"
 #include "GameFeaturesSubsystemSettings.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCAbilitySystemUtils.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GSCCoreComponent.h"
@@ -245,7 +246,7 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 		if (AbilitySystemComponent->bResetAbilitiesOnSpawn)
 		{
 			// ASC wants reset, remove abilities
-			UGSCAbilityInputBindingComponent* InputComponent = AvatarActor ? AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+			UGSCAbilityInputBindingComponent* InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(AvatarActor);
 			for (const FGameplayAbilitySpecHandle& AbilityHandle : ActorExtensions->Abilities)
 			{
 				if (InputComponent)
@@ -345,7 +346,7 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 	}
 
 	// GSCCore component could be added to avatars
-	UGSCCoreComponent* CoreComponent = AvatarActor ? AvatarActor->FindComponentByClass<UGSCCoreComponent>() : nullptr;
+	UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(AvatarActor);
 	if (CoreComponent)
 	{
 		// Make sure to notify we may have added attributes
@@ -384,7 +385,7 @@ void UGSCGameFeatureAction_AddAbilities::RemoveActorAbilities(const AActor* Acto
 			}
 
 			// Remove abilities
-			UGSCAbilityInputBindingComponent* InputComponent = Actor->FindComponentByClass<UGSCAbilityInputBindingComponent>();
+			UGSCAbilityInputBindingComponent* InputComponent = UGSCBlueprintFunctionLibrary::GetAbilityInputBindingComponent(Actor);
 			for (const FGameplayAbilitySpecHandle& AbilityHandle : ActorExtensions->Abilities)
 			{
 				if (InputComponent)
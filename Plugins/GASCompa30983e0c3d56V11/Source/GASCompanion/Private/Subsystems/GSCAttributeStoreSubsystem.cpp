@@ -0,0 +1,286 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCAttributeStoreSubsystem.h"
+
+#include "GSCStats.h"
+#include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Async/ParallelFor.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "Engine/World.h"
+
+namespace GSCAttributeStoreSubsystem_Impl
+{
+	/** Number of entities handled by each task, when running across task threads */
+	static constexpr int32 ParallelBatchSize = 1024;
+}
+
+bool UGSCAttributeStoreSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && UGSCDeveloperSettings::Get().bEnableAttributeStore;
+}
+
+void UGSCAttributeStoreSubsystem::Deinitialize()
+{
+	for (TArray<float>& Column : Columns)
+	{
+		Column.Empty();
+	}
+
+	DenseToSlot.Empty();
+	Slots.Empty();
+	FreeSlots.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGSCAttributeStoreSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	ApplyRegeneration(DeltaTime);
+}
+
+bool UGSCAttributeStoreSubsystem::IsTickable() const
+{
+	return bTickRegeneration && GetNumEntities() > 0;
+}
+
+TStatId UGSCAttributeStoreSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGSCAttributeStoreSubsystem, STATGROUP_GASCompanion);
+}
+
+bool UGSCAttributeStoreSubsystem::IsStoredAttribute(const FGameplayAttribute Attribute)
+{
+	return GetColumnIndex(Attribute) != INDEX_NONE;
+}
+
+FGSCAttributeStoreHandle UGSCAttributeStoreSubsystem::AddEntity()
+{
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+	Slots[Slot].DenseIndex = DenseToSlot.Add(Slot);
+
+	for (TArray<float>& Column : Columns)
+	{
+		Column.Add(0.f);
+	}
+
+	return FGSCAttributeStoreHandle(Slot, Slots[Slot].Serial);
+}
+
+void UGSCAttributeStoreSubsystem::RemoveEntity(const FGSCAttributeStoreHandle Handle)
+{
+	const int32 DenseIndex = GetDenseIndex(Handle);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Keeps entities packed, moving the last one in place of the removed one
+	for (TArray<float>& Column : Columns)
+	{
+		Column.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	}
+
+	DenseToSlot.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	if (DenseToSlot.IsValidIndex(DenseIndex))
+	{
+		Slots[DenseToSlot[DenseIndex]].DenseIndex = DenseIndex;
+	}
+
+	FSlot& RemovedSlot = Slots[Handle.Slot];
+	RemovedSlot.DenseIndex = INDEX_NONE;
+	++RemovedSlot.Serial;
+	FreeSlots.Add(Handle.Slot);
+}
+
+bool UGSCAttributeStoreSubsystem::IsValidEntity(const FGSCAttributeStoreHandle Handle) const
+{
+	return GetDenseIndex(Handle) != INDEX_NONE;
+}
+
+float UGSCAttributeStoreSubsystem::GetCurrentAttributeValue(const FGSCAttributeStoreHandle Handle, const FGameplayAttribute Attribute) const
+{
+	const int32 DenseIndex = GetDenseIndex(Handle);
+	const int32 ColumnIndex = GetColumnIndex(Attribute);
+	if (DenseIndex == INDEX_NONE || ColumnIndex == INDEX_NONE)
+	{
+		return 0.f;
+	}
+
+	return Columns[ColumnIndex][DenseIndex];
+}
+
+void UGSCAttributeStoreSubsystem::SetAttributeBase(const FGSCAttributeStoreHandle Handle, const FGameplayAttribute Attribute, const float NewValue)
+{
+	const int32 DenseIndex = GetDenseIndex(Handle);
+	const int32 ColumnIndex = GetColumnIndex(Attribute);
+	if (DenseIndex == INDEX_NONE || ColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Same as UGSCAttributeSet::PreAttributeChange / AdjustAttributeForMaxChange
+	EColumn AffectedColumn = EColumn::Num;
+	switch (static_cast<EColumn>(ColumnIndex))
+	{
+	case EColumn::MaxHealth:
+		AffectedColumn = EColumn::Health;
+		break;
+	case EColumn::MaxStamina:
+		AffectedColumn = EColumn::Stamina;
+		break;
+	case EColumn::MaxMana:
+		AffectedColumn = EColumn::Mana;
+		break;
+	default:
+		break;
+	}
+
+	if (AffectedColumn != EColumn::Num)
+	{
+		const float CurrentMaxValue = Columns[ColumnIndex][DenseIndex];
+		if (!FMath::IsNearlyEqual(CurrentMaxValue, NewValue) && CurrentMaxValue > 0.f)
+		{
+			float& AffectedValue = GetColumn(AffectedColumn)[DenseIndex];
+			AffectedValue = FMath::RoundToFloat(NewValue * AffectedValue / CurrentMaxValue);
+		}
+	}
+
+	Columns[ColumnIndex][DenseIndex] = NewValue;
+}
+
+void UGSCAttributeStoreSubsystem::ApplyRegeneration(const float DeltaTime)
+{
+	const int32 NumEntities = GetNumEntities();
+	if (NumEntities == 0 || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	float* Health = GetColumn(EColumn::Health).GetData();
+	float* Stamina = GetColumn(EColumn::Stamina).GetData();
+	float* Mana = GetColumn(EColumn::Mana).GetData();
+	const float* MaxHealth = GetColumn(EColumn::MaxHealth).GetData();
+	const float* MaxStamina = GetColumn(EColumn::MaxStamina).GetData();
+	const float* MaxMana = GetColumn(EColumn::MaxMana).GetData();
+	const float* HealthRegenRate = GetColumn(EColumn::HealthRegenRate).GetData();
+	const float* StaminaRegenRate = GetColumn(EColumn::StaminaRegenRate).GetData();
+	const float* ManaRegenRate = GetColumn(EColumn::ManaRegenRate).GetData();
+
+	auto RegenerateRange = [=](const int32 First, const int32 Num)
+	{
+		// Entities killed by ApplyDamage stay dead until their Health is set again
+		RegenerateNonDepleted(Health, MaxHealth, HealthRegenRate, First, Num, DeltaTime);
+		Regenerate(Stamina, MaxStamina, StaminaRegenRate, First, Num, DeltaTime);
+		Regenerate(Mana, MaxMana, ManaRegenRate, First, Num, DeltaTime);
+	};
+
+	if (ParallelEntityThreshold <= 0 || NumEntities < ParallelEntityThreshold)
+	{
+		RegenerateRange(0, NumEntities);
+		return;
+	}
+
+	using namespace GSCAttributeStoreSubsystem_Impl;
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumEntities, ParallelBatchSize);
+	ParallelFor(NumBatches, [&RegenerateRange, NumEntities](const int32 Batch)
+	{
+		const int32 First = Batch * ParallelBatchSize;
+		RegenerateRange(First, FMath::Min(ParallelBatchSize, NumEntities - First));
+	});
+}
+
+void UGSCAttributeStoreSubsystem::ApplyDamage(const TConstArrayView<FGSCAttributeStoreHandle> Handles, const float Damage, TArray<FGSCAttributeStoreHandle>* OutDeadEntities)
+{
+	// Handles may point to the same entity more than once, so damage isn't split across tasks
+	float* Health = GetColumn(EColumn::Health).GetData();
+	const float* MaxHealth = GetColumn(EColumn::MaxHealth).GetData();
+
+	for (const FGSCAttributeStoreHandle& Handle : Handles)
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		if (DenseIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const float OldHealth = Health[DenseIndex];
+		Health[DenseIndex] = FMath::Clamp(OldHealth - Damage, 0.f, MaxHealth[DenseIndex]);
+
+		if (OutDeadEntities && OldHealth > 0.f && Health[DenseIndex] <= 0.f)
+		{
+			OutDeadEntities->Add(Handle);
+		}
+	}
+}
+
+SIZE_T UGSCAttributeStoreSubsystem::GetAllocatedSize() const
+{
+	SIZE_T Size = DenseToSlot.GetAllocatedSize() + Slots.GetAllocatedSize() + FreeSlots.GetAllocatedSize();
+	for (const TArray<float>& Column : Columns)
+	{
+		Size += Column.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+int32 UGSCAttributeStoreSubsystem::GetColumnIndex(const FGameplayAttribute& Attribute)
+{
+	static const FGameplayAttribute StoredAttributes[NumColumns] =
+	{
+		UGSCAttributeSet::GetHealthAttribute(),
+		UGSCAttributeSet::GetMaxHealthAttribute(),
+		UGSCAttributeSet::GetHealthRegenRateAttribute(),
+		UGSCAttributeSet::GetStaminaAttribute(),
+		UGSCAttributeSet::GetMaxStaminaAttribute(),
+		UGSCAttributeSet::GetStaminaRegenRateAttribute(),
+		UGSCAttributeSet::GetManaAttribute(),
+		UGSCAttributeSet::GetMaxManaAttribute(),
+		UGSCAttributeSet::GetManaRegenRateAttribute(),
+	};
+
+	for (int32 Index = 0; Index < NumColumns; ++Index)
+	{
+		if (StoredAttributes[Index] == Attribute)
+		{
+			return Index;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 UGSCAttributeStoreSubsystem::GetDenseIndex(const FGSCAttributeStoreHandle Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Slot) || Slots[Handle.Slot].Serial != Handle.Serial)
+	{
+		return INDEX_NONE;
+	}
+
+	return Slots[Handle.Slot].DenseIndex;
+}
+
+void UGSCAttributeStoreSubsystem::Regenerate(float* RESTRICT Values, const float* RESTRICT MaxValues, const float* RESTRICT Rates, const int32 First, const int32 Num, const float DeltaTime)
+{
+	for (int32 Index = First; Index < First + Num; ++Index)
+	{
+		Values[Index] = FMath::Clamp(Values[Index] + Rates[Index] * DeltaTime, 0.f, MaxValues[Index]);
+	}
+}
+
+void UGSCAttributeStoreSubsystem::RegenerateNonDepleted(float* RESTRICT Values, const float* RESTRICT MaxValues, const float* RESTRICT Rates, const int32 First, const int32 Num, const float DeltaTime)
+{
+	for (int32 Index = First; Index < First + Num; ++Index)
+	{
+		// Select rather than skip, so the loop stays branchless
+		const float Value = Values[Index];
+		Values[Index] = Value > 0.f ? FMath::Clamp(Value + Rates[Index] * DeltaTime, 0.f, MaxValues[Index]) : Value;
+	}
+}
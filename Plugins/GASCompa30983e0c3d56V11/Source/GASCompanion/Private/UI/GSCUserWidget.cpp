@@ -8,7 +8,14 @@
 #include "AbilitySystemGlobals.h"
 #include "GameplayEffectTypes.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
+#include "Components/GSCCoreComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Widget Coalesced Attribute Changes"), STAT_GSC_WidgetCoalescedAttributeChanges, STATGROUP_GASCompanion);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Widget Cancelled Coalesced Attribute Changes"), STAT_GSC_WidgetCancelledAttributeChanges, STATGROUP_GASCompanion);
 
 void UGSCUserWidget::SetOwnerActor(AActor* Actor)
 {
@@ -41,12 +48,19 @@ void UGSCUserWidget::InitializeWithAbilitySystem(const UAbilitySystemComponent*
 
 	// Broadcast info to Blueprints
 	OnAbilitySystemInitialized();
+
+	// Widgets typically bind to the owner core component attribute events from OnAbilitySystemInitialized
+	if (UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(OwnerActor))
+	{
+		CoreComponent->BindAttributeChangeDelegatesIfListened();
+	}
 }
 
 void UGSCUserWidget::ResetAbilitySystem()
 {
 	ShutdownAbilitySystemComponentListeners();
 	AbilitySystemComponent = nullptr;
+	PendingAttributeChanges.Reset();
 }
 
 void UGSCUserWidget::RegisterAbilitySystemDelegates()
@@ -169,6 +183,18 @@ float UGSCUserWidget::GetAttributeValue(const FGameplayAttribute Attribute) cons
 
 void UGSCUserWidget::OnAttributeChanged(const FOnAttributeChangeData& Data)
 {
+	const UWorld* World = GetWorld();
+	if (bCoalesceAttributeChanges && World)
+	{
+		PendingAttributeChanges.FindOrAdd(Data.Attribute).Merge(Data.OldValue, Data.NewValue, Data.NewValue - Data.OldValue, FGameplayTagContainer::EmptyContainer);
+		if (!bAttributeChangesFlushScheduled)
+		{
+			bAttributeChangesFlushScheduled = true;
+			World->GetTimerManager().SetTimerForNextTick(this, &UGSCUserWidget::FlushCoalescedAttributeChanges);
+		}
+		return;
+	}
+
 	// Broadcast event to Blueprint
 	OnAttributeChange(Data.Attribute, Data.NewValue, Data.OldValue);
 
@@ -176,6 +202,33 @@ void UGSCUserWidget::OnAttributeChanged(const FOnAttributeChangeData& Data)
 	HandleAttributeChange(Data.Attribute, Data.NewValue, Data.OldValue);
 }
 
+void UGSCUserWidget::FlushCoalescedAttributeChanges()
+{
+	bAttributeChangesFlushScheduled = false;
+
+	// Changes made while broadcasting are merged in PendingAttributeChanges again, and schedule another flush
+	Swap(PendingAttributeChanges, FlushingAttributeChanges);
+
+	for (const TPair<FGameplayAttribute, FGSCCoalescedAttributeChange>& Pair : FlushingAttributeChanges)
+	{
+		const FGSCCoalescedAttributeChange& Change = Pair.Value;
+		INC_DWORD_STAT_BY(STAT_GSC_WidgetCoalescedAttributeChanges, Change.NumChanges);
+
+		// Same as uncoalesced changes, which ASC doesn't broadcast when the value didn't change
+		if (!Change.HasValueChanged())
+		{
+			INC_DWORD_STAT(STAT_GSC_WidgetCancelledAttributeChanges);
+			continue;
+		}
+
+		OnAttributeChange(Pair.Key, Change.NewValue, Change.OldValue);
+		OnCoalescedAttributeChange(Pair.Key, Change.NewValue, Change.OldValue, Change.NumChanges);
+		HandleAttributeChange(Pair.Key, Change.NewValue, Change.OldValue);
+	}
+
+	FlushingAttributeChanges.Reset();
+}
+
 void UGSCUserWidget::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, const FActiveGameplayEffectHandle ActiveHandle)
 {
 	FGameplayTagContainer AssetTags;
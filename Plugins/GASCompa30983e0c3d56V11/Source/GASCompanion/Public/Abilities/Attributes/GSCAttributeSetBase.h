@@ -147,6 +147,14 @@ public:
 	 */
 	virtual void AdjustAttributeForMaxChange(FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty) const;
 
+	/**
+	 * Sets the core component of the owner avatar, used to forward attribute change and gameplay effect execution events.
+	 *
+	 * Called by UGSCCoreComponent when it registers (or shuts down) ability system delegates. When not set, the core component is
+	 * looked up once on next use and cached until the avatar changes.
+	 */
+	void SetOwnerCoreComponent(UGSCCoreComponent* InCoreComponent);
+
 protected:
 
 	/**
@@ -156,4 +164,21 @@ protected:
 	 * @param OutExecutionData Returned structure with various information extracted from Data (Source / Target Actor, Controllers, etc.)
 	 */
 	virtual void GetExecutionDataFromMod(const FGameplayEffectModCallbackData& Data, OUT FGSCAttributeSetExecutionData& OutExecutionData);
+
+	/** Returns the core component of the owner avatar, from cache */
+	UGSCCoreComponent* GetOwnerCoreComponent(const AActor* AvatarActor);
+
+	/** Returns the core component of a source actor, cached for the last source (eg. repeated executions of a damage over time effect) */
+	UGSCCoreComponent* GetSourceCoreComponent(const AActor* SourceActor);
+
+private:
+	/** Core component resolved for an actor, valid as long as the actor is the same */
+	struct FCachedCoreComponent
+	{
+		TWeakObjectPtr<const AActor> Actor;
+		TWeakObjectPtr<UGSCCoreComponent> CoreComponent;
+	};
+
+	FCachedCoreComponent CachedOwnerCoreComponent;
+	FCachedCoreComponent CachedSourceCoreComponent;
 };
@@ -9,7 +9,9 @@
 #include "GSCAbilitySystemComponent.generated.h"
 
 class UGSCAbilityInputBindingComponent;
+class UGSCAbilityQueueComponent;
 class UGSCComboManagerComponent;
+class UGSCCoreComponent;
 class UInputAction;
 
 USTRUCT(BlueprintType)
@@ -82,6 +84,28 @@ struct FGSCMappedAbility
 	}
 };
 
+/**
+ * Companion components living on the ASC avatar actor.
+ *
+ * Resolved once when the avatar is set (or after an invalidation), so that hot paths like ability activated / ended callbacks
+ * don't have to go through FindComponentByClass and iterate the avatar owned components every time.
+ */
+struct FGSCAvatarComponentCache
+{
+	TWeakObjectPtr<const AActor> Avatar;
+	TWeakObjectPtr<UGSCCoreComponent> CoreComponent;
+	TWeakObjectPtr<UGSCAbilityQueueComponent> AbilityQueueComponent;
+	TWeakObjectPtr<UGSCComboManagerComponent> ComboManagerComponent;
+	TWeakObjectPtr<UGSCAbilityInputBindingComponent> AbilityInputBindingComponent;
+	bool bResolved = false;
+
+	/** Searches InAvatar owned components once and caches the companion ones */
+	void Resolve(const AActor* InAvatar);
+
+	/** Flags the cache for a new search on next access */
+	void Invalidate() { bResolved = false; }
+};
+
 DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnGiveAbility, FGameplayAbilitySpec&);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfo);
 
@@ -172,8 +196,29 @@ public:
 	 * (if child of GSCMeleeAbility, will activate combo via combo component)
 	 */
 	virtual void AbilityLocalInputPressed(int32 InputID) override;
+
+	/** Overrides InputReleased to only visit the specs bound to InputID, using the input index instead of scanning every activatable ability */
+	virtual void AbilityLocalInputReleased(int32 InputID) override;
 	//~ End UAbilitySystemComponent interface
 
+	/**
+	 * Flags the InputID -> ability spec index as stale, so that it gets rebuilt on next input press / release.
+	 *
+	 * Must be called whenever a spec InputID is changed outside of GiveAbility (eg. UGSCAbilityInputBindingComponent updating bindings).
+	 * Otherwise, inputs missing from the index are treated as not bound, and the spec is only dropped from its previous input.
+	 */
+	void MarkAbilityInputIndexDirty() { bAbilityInputIndexDirty = true; }
+
+	/**
+	 * Returns companion components of the current avatar actor, resolving them first if the avatar changed or the cache was invalidated.
+	 *
+	 * Prefer UGSCBlueprintFunctionLibrary getters (GetCompanionCoreComponent, etc.) which go through this cache when possible.
+	 */
+	const FGSCAvatarComponentCache& GetAvatarComponentCache();
+
+	/** Flags the avatar component cache as stale. Called by companion components when they are registered / unregistered. */
+	void InvalidateAvatarComponentCache() { AvatarComponentCache.Invalidate(); }
+
 	/**
 	 * DEPRECATED: Please use regular ASC->GiveAbility() method instead.
 	 *
@@ -262,10 +307,45 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UGSCComboManagerComponent> ComboComponent;
 
+	// Cached companion components on the avatar actor
+	FGSCAvatarComponentCache AvatarComponentCache;
+
 	//~ Begin UAbilitySystemComponent interface
 	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
 	//~ End UAbilitySystemComponent interface
 
+	/** Spec bound to an input, with its index in ActivatableAbilities.Items when it was indexed */
+	struct FAbilityInputIndexEntry
+	{
+		FGameplayAbilitySpecHandle Handle;
+		int32 SpecIndex = INDEX_NONE;
+	};
+
+	/** InputID -> specs bound to that input */
+	TMap<int32, TArray<FAbilityInputIndexEntry, TInlineAllocator<2>>> AbilityInputIndex;
+
+	/** Whether AbilityInputIndex needs a full rebuild before its next use */
+	bool bAbilityInputIndexDirty = true;
+
+	/** Rebuilds AbilityInputIndex from ActivatableAbilities */
+	void RebuildAbilityInputIndex();
+
+	/**
+	 * Gathers the ActivatableAbilities indices of specs bound to InputID, rebuilding the index first if it is dirty or
+	 * turns out to be stale. Must be called with the ability list locked, so that indices stay valid while iterating.
+	 */
+	void GatherAbilitySpecsForInput(int32 InputID, TArray<int32, TInlineAllocator<4>>& OutSpecIndices);
+
+	/**
+	 * Gathers the ActivatableAbilities indices of indexed specs for InputID.
+	 *
+	 * Returns false if the index is stale for InputID: an indexed spec was removed, moved or bound to another input. An InputID
+	 * missing from the index isn't bound, without looking at ActivatableAbilities.
+	 */
+	bool ResolveAbilityInputIndex(int32 InputID, TArray<int32, TInlineAllocator<4>>& OutSpecIndices) const;
+
 	/** Called when Ability System Component is initialized */
 	void GrantStartupEffects();
 
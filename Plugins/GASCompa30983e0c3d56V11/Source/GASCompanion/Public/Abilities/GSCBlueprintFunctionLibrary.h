@@ -53,6 +53,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GAS Companion|Components")
 	static UGSCAbilityInputBindingComponent* GetAbilityInputBindingComponent(const AActor* Actor);
 
+	/**
+	* Flags the companion component cache of the actor's ASC as stale, if Actor is the avatar of a GSC ASC.
+	*
+	* Companion components call this when they are registered / unregistered, component getters above will search again on next call.
+	*/
+	static void InvalidateCompanionComponentCache(const AActor* Actor);
+
 	/** Gameplay Tags */
 
 	/**
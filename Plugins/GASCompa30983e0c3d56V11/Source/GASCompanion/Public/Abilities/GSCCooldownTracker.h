@@ -0,0 +1,117 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Tracks running ability cooldowns, keyed by ability spec handle, on a hierarchical timer wheel.
+ *
+ * Start, cancel and queries (remaining time, fraction) are O(1). Advance only visits the wheel slots elapsed since the last call,
+ * which makes the per frame cost independent of the number of running cooldowns.
+ *
+ * The wheel has three levels:
+ *
+ * - 256 slots of SlotDuration each, for cooldowns ending within the next 256 slots
+ * - 64 slots covering 256 level 0 slots each, cascaded into level 0 when it wraps around
+ * - An overflow list for longer cooldowns, cascaded when level 1 wraps around
+ *
+ * Expiration is never reported early, and at most one slot (plus the Advance granularity) late.
+ */
+class GASCOMPANION_API FGSCCooldownTracker
+{
+public:
+	/** Called by Advance for each expired cooldown. The cooldown is no longer tracked when called, and can be started again. */
+	using FOnCooldownExpired = TFunctionRef<void(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, float Duration)>;
+
+	explicit FGSCCooldownTracker(double InSlotDuration = 1.0 / 30.0);
+
+	/**
+	 * Starts (or restarts) tracking the cooldown of an ability.
+	 *
+	 * @param AbilitySpecHandle The ability the cooldown belongs to
+	 * @param CooldownTags Cooldown tags of the ability, passed back on expiration
+	 * @param Now Current world time in seconds
+	 * @param TimeRemaining Time until the cooldown ends
+	 * @param Duration Total duration of the cooldown
+	 */
+	void Start(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, double Now, float TimeRemaining, float Duration);
+
+	/** Stops tracking the cooldown of an ability, without reporting it as expired. Returns false if it wasn't tracked. */
+	bool Cancel(const FGameplayAbilitySpecHandle& AbilitySpecHandle);
+
+	/** Stops tracking the cooldown of an ability and reports it as expired right away. Returns false if it wasn't tracked. */
+	bool Expire(const FGameplayAbilitySpecHandle& AbilitySpecHandle, FOnCooldownExpired OnExpired);
+
+	/** Advances the wheel to Now, calling OnExpired for each cooldown ending in the meantime */
+	void Advance(double Now, FOnCooldownExpired OnExpired);
+
+	/** Stops tracking every cooldown */
+	void Reset();
+
+	bool IsTracking(const FGameplayAbilitySpecHandle& AbilitySpecHandle) const;
+
+	/** Returns the time remaining before the cooldown of an ability ends, or 0 if it isn't tracked */
+	float GetTimeRemaining(const FGameplayAbilitySpecHandle& AbilitySpecHandle, double Now) const;
+
+	/** Returns the remaining fraction (1 when just started, 0 when over) of the cooldown of an ability, or 0 if it isn't tracked */
+	float GetRemainingFraction(const FGameplayAbilitySpecHandle& AbilitySpecHandle, double Now) const;
+
+	/** Returns whether one of the given tags is a cooldown tag of a tracked cooldown */
+	bool HasAnyCooldownTag(const FGameplayTagContainer& Tags) const;
+
+	/** Gathers handles of tracked cooldowns having one of the given tags as cooldown tags */
+	void GetCooldownsWithAnyTag(const FGameplayTagContainer& Tags, TArray<FGameplayAbilitySpecHandle>& OutAbilitySpecHandles) const;
+
+	int32 Num() const
+	{
+		return EntryIndexByHandle.Num();
+	}
+
+private:
+	static constexpr int32 NumLevel0Slots = 256;
+	static constexpr int32 Level0Bits = 8;
+	static constexpr int32 NumLevel1Slots = 64;
+	static constexpr int32 OverflowBucket = NumLevel0Slots + NumLevel1Slots;
+	static constexpr int32 NumBuckets = OverflowBucket + 1;
+
+	struct FEntry
+	{
+		FGameplayAbilitySpecHandle AbilitySpecHandle;
+		FGameplayTagContainer CooldownTags;
+		double EndTime = 0.0;
+		float Duration = 0.f;
+		int64 ExpiryTick = 0;
+		int32 Bucket = INDEX_NONE;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	double SlotDuration;
+	int64 CurrentTick = 0;
+
+	TSparseArray<FEntry> Entries;
+	TMap<FGameplayAbilitySpecHandle, int32> EntryIndexByHandle;
+
+	/** Number of tracked cooldowns per cooldown tag, for quick filtering in HasAnyCooldownTag */
+	TMap<FGameplayTag, int32> CooldownTagCounts;
+
+	/** Head entry index of the intrusive list for each bucket (level 0 slots, level 1 slots, then overflow) */
+	int32 BucketHeads[NumBuckets];
+
+	int64 GetTickForTime(double Time) const;
+	void Link(int32 EntryIndex);
+	void Unlink(int32 EntryIndex);
+	void Remove(int32 EntryIndex);
+
+	/** Removes an unlinked entry and reports it as expired */
+	void RemoveExpired(int32 EntryIndex, FOnCooldownExpired OnExpired);
+
+	/** Removes Entry from handle and tag lookups */
+	void Forget(const FEntry& Entry);
+
+	/** Re-links every entry of a bucket, according to the current tick */
+	void Cascade(int32 Bucket);
+};
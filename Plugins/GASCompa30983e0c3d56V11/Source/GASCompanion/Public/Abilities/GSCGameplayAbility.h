@@ -55,6 +55,24 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Ability")
 	bool bEnableAbilityQueue = false;
 
+	/**
+	 * If true, gameplay effect specs built for effect containers are cached per effect class and level, on instanced abilities.
+	 *
+	 * Making a container spec then copies the cached spec and only patches what changes from one use to the next (effect context,
+	 * captured source tags and attributes, ability and dynamic source tags, and SetByCaller magnitudes) instead of building a spec
+	 * from scratch. Targets are still gathered on each use. See InvalidateEffectContainerSpecCache for what isn't picked up.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = GameplayEffects)
+	bool bCacheEffectContainerSpecs = true;
+
+	/**
+	 * Whether applying an effect container spec resolves its targets once and applies each effect to all of them in one pass.
+	 *
+	 * Targets of a same target data share a single effect context, instead of one copy per target and effect.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = GameplayEffects)
+	bool bBatchEffectContainerApplication = true;
+
     /** Map of gameplay tags to gameplay effect containers */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayEffects)
     TMap<FGameplayTag, FGSCGameplayEffectContainer> EffectContainerMap;
@@ -109,6 +127,20 @@ public:
 	/** Called on ability end */
 	void AbilityEnded(UGameplayAbility* Ability);
 
+	/**
+	 * Clears cached effect specs (see bCacheEffectContainerSpecs). Changing the avatar clears them already.
+	 *
+	 * Must be called when something else MakeOutgoingGameplayEffectSpec depends on changes at runtime, eg. an override of it or
+	 * of ApplyAbilityTagsToGameplayEffectSpec reading ability state, or effect class defaults modified while playing.
+	 */
+	void InvalidateEffectContainerSpecCache();
+
+	/** Returns the number of cached effect specs (see bCacheEffectContainerSpecs) */
+	int32 GetNumCachedEffectContainerSpecs() const
+	{
+		return CachedEffectContainerSpecs.Num();
+	}
+
 protected:
 
 	//~Begin UGameplayAbility interface
@@ -118,14 +150,41 @@ protected:
     virtual void PreActivate(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, FOnGameplayAbilityEnded::FDelegate* OnGameplayAbilityEndedDelegate, const FGameplayEventData* TriggerEventData) override;
 	//~End UGameplayAbility interface
 
+	/** Applies every effect spec of a container spec to all of its targets, resolving target ASCs and effect contexts once */
+	void ApplyEffectContainerSpecBatched(const FGSCGameplayEffectContainerSpec& ContainerSpec, TArray<FActiveGameplayEffectHandle>& OutEffectHandles) const;
+
+	/** Makes an outgoing spec for an effect container, copying the one cached for this effect class and level if enabled */
+	FGameplayEffectSpecHandle MakeEffectContainerOutgoingSpec(TSubclassOf<UGameplayEffect> EffectClass, int32 Level);
+
+	/**
+	 * Reference implementation of the loose cost check, building a full spec for the effect. Only checks that current values of
+	 * attributes modified additively are > 0.
+	 */
+	bool CanApplyPositiveAttributeModifiers(const UGameplayEffect *GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo, float Level, const FGameplayEffectContextHandle& EffectContext) const;
+
+	/**
+	 * Same check as CanApplyPositiveAttributeModifiers, using the attributes compiled from the effect modifiers once (see
+	 * CompileCostCheckAttributes) instead of building a spec on every check.
+	 */
+	bool CanApplyPositiveCostAttributes(const UGameplayEffect* GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo) const;
+
 private:
 
+	/** Effect specs built for effect containers, by effect class and level, copied and patched on each use */
+	TMap<TTuple<const UClass*, int32>, FGameplayEffectSpecHandle> CachedEffectContainerSpecs;
+
+	/** Effect CostCheckAttributes were compiled from */
+	mutable TWeakObjectPtr<const UGameplayEffect> CostCheckEffect;
+
+	/** Attributes of the additive modifiers of CostCheckEffect, the only ones the loose cost check looks at */
+	mutable TArray<FGameplayAttribute> CostCheckAttributes;
+
+	/** Compiles CostCheckAttributes if GameplayEffect isn't the effect they were compiled from */
+	void CompileCostCheckAttributes(const UGameplayEffect* GameplayEffect) const;
+
 	/** Loosely Check for cost attribute current value to be positive */
 	bool CheckForPositiveCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags) const;
 
-	/** Does the actual check for attribute modifiers, only checking it their current value is <= 0 */
-	bool CanApplyPositiveAttributeModifiers(const UGameplayEffect *GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo, float Level, const FGameplayEffectContextHandle& EffectContext) const;
-
 	/** Returns spawned attribute set from passed in ASC based on provided AttributeClass (mainly because GetAttributeSuboject on AbilitySystemComponent is protected) */
     static const UAttributeSet* GetAttributeSubobjectForASC(UAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UAttributeSet> AttributeClass);
 };
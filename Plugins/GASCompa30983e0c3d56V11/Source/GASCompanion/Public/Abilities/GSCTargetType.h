@@ -28,4 +28,12 @@ class GASCOMPANION_API UGSCTargetType : public UObject
 	/** Called to determine targets to apply gameplay effects to */
 	UFUNCTION(BlueprintNativeEvent)
     void GetTargets(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Adds targets to target data, used by effect containers.
+	 *
+	 * Default implementation calls GetTargets, adding a target data per hit result and one for all actors. Native target types
+	 * can override it to add their targets directly.
+	 */
+	virtual void AppendTargetData(AActor* TargetingActor, const FGameplayEventData& EventData, FGameplayAbilityTargetDataHandle& OutTargetData) const;
 };
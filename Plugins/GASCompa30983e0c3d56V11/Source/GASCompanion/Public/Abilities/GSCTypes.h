@@ -83,4 +83,52 @@ public:
 
 	/** Adds new targets to target data */
 	void AddTargets(const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors);
+
+	/** Adds a target data per hit result and one for all actors to OutTargetData, as AddTargets does */
+	static void AddTargets(FGameplayAbilityTargetDataHandle& OutTargetData, const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors);
+};
+
+/**
+ * Accumulates the changes of a single attribute within a frame, so that they can be broadcast once (attribute change coalescing).
+ *
+ * OldValue is the value before the first merged change, NewValue the value after the last one. DeltaValue is the sum of merged deltas.
+ */
+struct FGSCCoalescedAttributeChange
+{
+	float OldValue = 0.f;
+	float NewValue = 0.f;
+	float DeltaValue = 0.f;
+	int32 NumChanges = 0;
+	FGameplayTagContainer EventTags;
+
+	bool IsPending() const
+	{
+		return NumChanges > 0;
+	}
+
+	/** Whether merged changes didn't cancel each other out */
+	bool HasValueChanged() const
+	{
+		return OldValue != NewValue;
+	}
+
+	void Merge(const float InOldValue, const float InNewValue, const float InDeltaValue, const FGameplayTagContainer& InEventTags)
+	{
+		if (NumChanges == 0)
+		{
+			OldValue = InOldValue;
+		}
+
+		NewValue = InNewValue;
+		DeltaValue += InDeltaValue;
+		EventTags.AppendTags(InEventTags);
+		++NumChanges;
+	}
+
+	void Reset()
+	{
+		OldValue = NewValue = DeltaValue = 0.f;
+		NumChanges = 0;
+		EventTags.Reset();
+	}
 };
@@ -0,0 +1,23 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/TargetTypes/GSCTargetTypeOverlap.h"
+#include "GSCTargetTypeBox.generated.h"
+
+/** Targets actors within a box oriented like the targeting actor */
+UCLASS(Blueprintable)
+class GASCOMPANION_API UGSCTargetTypeBox : public UGSCTargetTypeOverlap
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	FVector HalfExtent = FVector(200.f, 200.f, 100.f);
+
+protected:
+	//~ Begin UGSCTargetTypeOverlap interface
+	virtual FCollisionShape GetCollisionShape() const override;
+	//~ End UGSCTargetTypeOverlap interface
+};
@@ -0,0 +1,26 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/TargetTypes/GSCTargetTypeOverlap.h"
+#include "GSCTargetTypeCapsule.generated.h"
+
+/** Targets actors within a capsule oriented like the targeting actor */
+UCLASS(Blueprintable)
+class GASCOMPANION_API UGSCTargetTypeCapsule : public UGSCTargetTypeOverlap
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0, Units = "cm"))
+	float Radius = 200.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0, Units = "cm"))
+	float HalfHeight = 200.f;
+
+protected:
+	//~ Begin UGSCTargetTypeOverlap interface
+	virtual FCollisionShape GetCollisionShape() const override;
+	//~ End UGSCTargetTypeOverlap interface
+};
@@ -0,0 +1,35 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/TargetTypes/GSCTargetTypeOverlap.h"
+#include "GSCTargetTypeCone.generated.h"
+
+/**
+ * Targets actors within Range of the targeting actor and HalfAngle degrees of its forward vector.
+ *
+ * Queries a sphere of radius Range, then tests the angle of each candidate. Candidates are kept if their location is within the
+ * cone, or else if the point of their overlapped component closest to the cone axis is.
+ */
+UCLASS(Blueprintable)
+class GASCOMPANION_API UGSCTargetTypeCone : public UGSCTargetTypeOverlap
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0, Units = "cm"))
+	float Range = 500.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0, ClampMax = 180, Units = "deg"))
+	float HalfAngle = 45.f;
+
+protected:
+	//~ Begin UGSCTargetTypeOverlap interface
+	virtual FCollisionShape GetCollisionShape() const override;
+	virtual bool IsWithinShape(const FTransform& QueryTransform, const FOverlapResult& Overlap) const override;
+	//~ End UGSCTargetTypeOverlap interface
+
+	/** Returns whether a location is within Range and HalfAngle */
+	bool IsWithinCone(const FTransform& QueryTransform, const FVector& Location) const;
+};
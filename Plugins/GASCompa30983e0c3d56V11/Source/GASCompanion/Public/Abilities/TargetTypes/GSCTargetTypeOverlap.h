@@ -0,0 +1,104 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GSCTargetType.h"
+#include "CollisionShape.h"
+#include "Engine/EngineTypes.h"
+#include "GSCTargetTypeOverlap.generated.h"
+
+struct FOverlapResult;
+
+/** Which targets to keep, based on their attitude towards the targeting actor (see IGenericTeamAgentInterface) */
+UENUM(BlueprintType)
+enum class EGSCTargetTeamFilter : uint8
+{
+	/** Keep every target */
+	Any,
+
+	/** Keep hostile targets only */
+	Hostile,
+
+	/** Keep hostile and neutral targets */
+	NotFriendly,
+
+	/** Keep friendly targets only */
+	Friendly,
+};
+
+/**
+ * Base class for target types gathering actors overlapping a shape around the targeting actor.
+ *
+ * Runs a single overlap query per use, then filters candidates (targeting actor, team, ability system component, exact shape, line of
+ * sight), sorts them by distance (then name, so that results are deterministic) and keeps up to MaxTargets of them.
+ *
+ * Targets are added as a single actor array target data. Subclasses provide the query shape.
+ */
+UCLASS(Abstract, Blueprintable)
+class GASCOMPANION_API UGSCTargetTypeOverlap : public UGSCTargetType
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTargetTypeOverlap();
+
+	/** Object types to query */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	TArray<TEnumAsByte<ECollisionChannel>> ObjectTypes;
+
+	/** Offset of the query shape, relative to the targeting actor */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	FVector Offset = FVector::ZeroVector;
+
+	/** Whether the targeting actor can be a target */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	bool bIncludeTargetingActor = false;
+
+	/** Which targets to keep, based on their attitude towards the targeting actor */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	EGSCTargetTeamFilter TeamFilter = EGSCTargetTeamFilter::Any;
+
+	/** Whether targets need an ability system component */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	bool bRequireAbilitySystemComponent = true;
+
+	/** Whether targets need to be visible from the query origin, traced on LineOfSightChannel */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting")
+	bool bRequireLineOfSight = false;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (EditCondition = "bRequireLineOfSight"))
+	TEnumAsByte<ECollisionChannel> LineOfSightChannel = ECC_Visibility;
+
+	/** Maximum number of targets, closest ones first. 0 for no limit */
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0))
+	int32 MaxTargets = 0;
+
+	//~ Begin UGSCTargetType interface
+	virtual void GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const override;
+	virtual void AppendTargetData(AActor* TargetingActor, const FGameplayEventData& EventData, FGameplayAbilityTargetDataHandle& OutTargetData) const override;
+	//~ End UGSCTargetType interface
+
+protected:
+	/** Returns the shape to query, positioned at the query transform */
+	virtual FCollisionShape GetCollisionShape() const PURE_VIRTUAL(UGSCTargetTypeOverlap::GetCollisionShape, return FCollisionShape(););
+
+	/**
+	 * Returns whether an overlapped component is within the exact shape, for shapes approximated by the query (eg. cones).
+	 *
+	 * Like the query itself, the component only has to be partly within the shape.
+	 */
+	virtual bool IsWithinShape(const FTransform& QueryTransform, const FOverlapResult& Overlap) const
+	{
+		return true;
+	}
+
+	/** Returns the transform of the query shape, from the targeting actor and Offset */
+	FTransform GetQueryTransform(const AActor* TargetingActor) const;
+
+	/** Queries and filters targets, calling AddTarget for each of them, closest first */
+	void GatherTargets(AActor* TargetingActor, const FTransform& QueryTransform, TFunctionRef<void(AActor*)> AddTarget) const;
+
+private:
+	bool PassesTeamFilter(const AActor* TargetingActor, const AActor* Target) const;
+};
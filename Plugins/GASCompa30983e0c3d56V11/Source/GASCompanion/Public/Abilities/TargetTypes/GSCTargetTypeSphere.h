@@ -0,0 +1,23 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/TargetTypes/GSCTargetTypeOverlap.h"
+#include "GSCTargetTypeSphere.generated.h"
+
+/** Targets actors within Radius of the targeting actor */
+UCLASS(Blueprintable)
+class GASCOMPANION_API UGSCTargetTypeSphere : public UGSCTargetTypeOverlap
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, Category = "Targeting", meta = (ClampMin = 0, Units = "cm"))
+	float Radius = 300.f;
+
+protected:
+	//~ Begin UGSCTargetTypeOverlap interface
+	virtual FCollisionShape GetCollisionShape() const override;
+	//~ End UGSCTargetTypeOverlap interface
+};
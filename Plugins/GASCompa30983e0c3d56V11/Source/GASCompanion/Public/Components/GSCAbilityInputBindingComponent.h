@@ -68,6 +68,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category= "Player Controls", meta=(DisplayAfter="InputPriority", EditCondition = "TargetInputCancel != nullptr", EditConditionHides))
 	EGSCAbilityTriggerEvent TargetCancelTriggerEvent = EGSCAbilityTriggerEvent::Started;
 
+	//~ Begin UActorComponent interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	//~ End UActorComponent interface
+
 	//~ Begin UPlayerControlsComponent interface
 	virtual void SetupPlayerControls_Implementation(UEnhancedInputComponent* PlayerInputComponent) override;
 	virtual void ReleaseInputComponent(AController* OldController) override;
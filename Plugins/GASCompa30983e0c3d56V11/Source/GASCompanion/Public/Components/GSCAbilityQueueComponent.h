@@ -50,8 +50,10 @@ public:
 
     /**
      * Updates the Allowed Abilities for the ability queue system
+     *
+     * Debug widgets are only notified if the set of allowed abilities actually changed.
      */
-    void UpdateAllowedAbilitiesForAbilityQueue(TArray<TSubclassOf<UGameplayAbility>> AllowedAbilities);
+    void UpdateAllowedAbilitiesForAbilityQueue(const TArray<TSubclassOf<UGameplayAbility>>& AllowedAbilities);
 
 	/**
 	 * Updates the bQueueAllowAllAbilities which prevents the check for queued abilities to be within the QueuedAllowedAbilities array
@@ -66,6 +68,9 @@ public:
 
     TArray<TSubclassOf<UGameplayAbility>> GetQueuedAllowedAbilities() const;
 
+	/** Returns whether the given ability class can be queued, either because all abilities are allowed or it is within allowed abilities */
+	bool IsAbilityAllowedForAbilityQueue(TSubclassOf<UGameplayAbility> AbilityClass) const;
+
 	/**
 	* Called when an ability is ended for the owner actor.
 	*
@@ -85,6 +90,11 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	//~ Begin UActorComponent interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	//~ End UActorComponent interface
+
 	/** Ability Queue System */
 
 	bool bAbilityQueueOpened = false;
@@ -93,7 +103,8 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UGameplayAbility> QueuedAbility;
 	
-	TArray<TSubclassOf<UGameplayAbility>> QueuedAllowedAbilities;
+	/** Allowed abilities for the ability queue, keyed by class for constant time lookups when abilities end or fail */
+	TSet<TSubclassOf<UGameplayAbility>> QueuedAllowedAbilities;
 
 	/**
 	* Reset all variables involved in the Ability Queue System to their original default values.
@@ -102,6 +113,8 @@ protected:
 
 	/**
 	* Notify Debug Ability Queue Widget by updating its allowed abilities
+	*
+	* Only called when allowed abilities (or whether all abilities are allowed) changed.
 	*/
 	virtual void UpdateDebugWidgetAllowedAbilities();
 };
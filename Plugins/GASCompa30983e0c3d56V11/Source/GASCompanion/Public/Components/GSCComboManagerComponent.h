@@ -12,6 +12,61 @@ class UAbilitySystemComponent;
 class UGSCGameplayAbility;
 class ACharacter;
 
+/**
+ * Combo state replicated to the owning client, net serialized in 11 bits: the combo flags as a bitfield, and the combo index
+ * quantized to 7 bits (clamped to MaxComboIndex).
+ */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCComboState
+{
+	GENERATED_BODY()
+
+	static constexpr int32 ComboIndexBits = 7;
+	static constexpr int32 MaxComboIndex = (1 << ComboIndexBits) - 1;
+	static constexpr int32 NumFlags = 4;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
+	int32 ComboIndex = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
+	bool bComboWindowOpened = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
+	bool bShouldTriggerCombo = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
+	bool bRequestTriggerCombo = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
+	bool bNextComboAbilityActivated = false;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FGSCComboState& Other) const
+	{
+		return ComboIndex == Other.ComboIndex
+			&& bComboWindowOpened == Other.bComboWindowOpened
+			&& bShouldTriggerCombo == Other.bShouldTriggerCombo
+			&& bRequestTriggerCombo == Other.bRequestTriggerCombo
+			&& bNextComboAbilityActivated == Other.bNextComboAbilityActivated;
+	}
+
+	bool operator!=(const FGSCComboState& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGSCComboState> : TStructOpsTypeTraitsBase2<FGSCComboState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 UCLASS(BlueprintType, Blueprintable, ClassGroup=("GASCompanion"), meta=(BlueprintSpawnableComponent))
 class GASCOMPANION_API UGSCComboManagerComponent : public UActorComponent
 {
@@ -31,27 +86,42 @@ public:
 	/** Reference to GA_GSC_Melee_Base */
 	TSubclassOf<UGSCGameplayAbility> MeleeBaseAbility;
 
+	/**
+	 * Whether the owning client advances combos locally instead of going through the server (and a multicast back).
+	 *
+	 * When enabled, combo windows are handled by the locally controlled owner. Combo abilities are activated with local prediction,
+	 * carrying the predicted combo index in their activation event data: the server confirms it (or corrects it when invalid), and a
+	 * rejected activation rolls the combo index back. Combo state isn't replicated at all (see ReplicatedComboState).
+	 *
+	 * Requires combo abilities to use the Local Predicted net execution policy.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS Companion|Combo")
+	bool bPredictComboAdvancement = false;
+
 	/** The combo index for the currently active combo */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	int32 ComboIndex = 0;
 
 	/** Whether or not the combo window is opened (eg. player can queue next combo within this window) */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bComboWindowOpened = false;
 
 	/** Should we queue the next combo montage for the currently active combo */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bShouldTriggerCombo = false;
 
 	/** Should we trigger the next combo montage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bRequestTriggerCombo = false;
 
 	/** Should we trigger the next combo montage */
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GAS Companion|Combo")
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Combo")
 	bool bNextComboAbilityActivated = false;
 
+	//~ Begin UObject interface
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	//~ End UObject interface
 
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
@@ -73,10 +143,54 @@ public:
 
 	void SetComboIndex(int32 InComboIndex);
 
+	/** Returns the combo index the next combo ability activation will use (eg. incremented if the combo window is opened) */
+	int32 GetNextComboIndex() const;
+
+	/**
+	 * Activates a combo ability, going through prediction when the owning client predicts combo advancement.
+	 *
+	 * Predicted activations carry the next combo index in their event data, see ApplyComboActivationData.
+	 */
+	bool TryActivateComboAbility(TSubclassOf<UGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
+
+	/**
+	 * Called by combo abilities on activation, with the event data they were activated with.
+	 *
+	 * Applies the combo index of a predicted activation (registering a rollback if the server rejects it, or validating it on the
+	 * server against its own combo window, see ShouldTrackComboWindow). Returns false if the activation wasn't predicted by this
+	 * component, in which case IncrementCombo should be used.
+	 */
+	bool ApplyComboActivationData(const FGameplayEventData* TriggerEventData, const FGameplayAbilityActivationInfo& ActivationInfo);
+
 	/** Returns true if this component's actor has authority */
 	virtual bool IsOwnerActorAuthoritative() const;
 
+	/** Returns true if this is the owning client advancing combos locally (see bPredictComboAdvancement) */
+	bool IsLocallyPredictingCombo() const;
+
+	/** Returns true if combo windows (and combo notifies) should be handled on this machine */
+	bool ShouldHandleComboWindow() const;
+
+	/**
+	 * Returns true if bComboWindowOpened should follow combo window notifies on this machine. Besides where combo windows are
+	 * handled, this is the server for owning clients predicting combos, so that it can validate their predicted combo index.
+	 */
+	bool ShouldTrackComboWindow() const;
+
+	/** Returns the current combo state, as it is replicated */
+	FGSCComboState GetComboState() const;
+
+	/** Applies a replicated combo state */
+	void SetComboState(const FGSCComboState& InComboState);
+
 protected:
+	/**
+	 * Combo state replicated to the owning client only (it isn't needed by simulated proxies), and not at all when predicting combo
+	 * advancement. Push based: it is gathered from the combo properties above and marked dirty in PreReplication, only when changed.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedComboState)
+	FGSCComboState ReplicatedComboState;
+
 	/** Cached value of rather this is a simulated actor */
 	UPROPERTY()
 	bool bCachedIsNetSimulated;
@@ -84,6 +198,7 @@ protected:
 	//~Begin UActorComponent interface
 	virtual void BeginPlay() override;
 	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	//~End UActorComponent interface
 
 	UFUNCTION(Server, Reliable)
@@ -100,6 +215,16 @@ protected:
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastSetComboIndex(int32 InComboIndex);
 
+	/** Sent to the owning client when a predicted combo index is invalid, with the one the server ended up using */
+	UFUNCTION(Client, Reliable)
+	void ClientCorrectComboIndex(int32 InComboIndex);
+
+	UFUNCTION()
+	void OnRep_ReplicatedComboState();
+
+	/** Rolls back a predicted combo index, unless the combo moved on since */
+	void OnComboPredictionRejected(int32 PreviousComboIndex, int32 PredictedComboIndex);
+
 private:
 	/** Caches the flags that indicate whether this component has network authority. */
 	void CacheIsNetSimulated();
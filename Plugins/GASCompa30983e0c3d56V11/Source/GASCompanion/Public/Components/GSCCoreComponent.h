@@ -7,6 +7,8 @@
 #include "AttributeSet.h"
 #include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
+#include "Abilities/GSCCooldownTracker.h"
+#include "Abilities/GSCTypes.h"
 #include "UI/GSCUWHud.h"
 #include "GSCCoreComponent.generated.h"
 
@@ -40,10 +42,25 @@ struct FGSCGameplayEffectExecuteData
 	float ClampMinimumValue = 0.f;
 };
 
+/** Controls which attributes UGSCCoreComponent listens to for OnAttributeChange */
+UENUM(BlueprintType)
+enum class EGSCAttributeSubscription : uint8
+{
+	/** Bind every attribute of the Ability System Component (default, legacy behavior) */
+	AllAttributes,
+
+	/** Only bind attributes listed in SubscribedAttributes */
+	SubscribedAttributes,
+
+	/** Bind every attribute, but only once OnAttributeChange or OnCoalescedAttributeChange has listeners (see BindAttributeChangeDelegatesIfListened) */
+	WhenListened,
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnDeath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfoCore);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGSCOnDefaultAttributeChange, float, DeltaValue, const struct FGameplayTagContainer, EventTags);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnAttributeChange, FGameplayAttribute, Attribute, float, DeltaValue, const struct FGameplayTagContainer, EventTags);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FGSCOnCoalescedAttributeChange, FGameplayAttribute, Attribute, float, OldValue, float, NewValue, int32, NumChanges);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnPreAttributeChange, UGSCAttributeSetBase*, AttributeSet, FGameplayAttribute, Attribute, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FGSCOnPostGameplayEffectExecute, FGameplayAttribute, Attribute, AActor*, SourceActor, AActor*, TargetActor, const FGameplayTagContainer&, SourceTags, const FGSCGameplayEffectExecuteData, Payload);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGSCOnAbilityActivated, const UGameplayAbility*, Ability);
@@ -97,6 +114,69 @@ public:
 	/** Clean up any bound delegates to Ability System delegates */
 	void ShutdownAbilitySystemDelegates(UAbilitySystemComponent* ASC);
 
+	/**
+	 * Controls which attributes are bound to broadcast OnAttributeChange.
+	 *
+	 * Every bound attribute pays for a delegate dispatch on each change, restrict it to the attributes actually consumed
+	 * for actors with many attributes or frequent changes (periodic effects).
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Attributes")
+	EGSCAttributeSubscription AttributeSubscription = EGSCAttributeSubscription::AllAttributes;
+
+	/** Attributes to broadcast OnAttributeChange for, when AttributeSubscription is set to SubscribedAttributes */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Attributes", meta=(EditCondition = "AttributeSubscription == EGSCAttributeSubscription::SubscribedAttributes", EditConditionHides))
+	TArray<FGameplayAttribute> SubscribedAttributes;
+
+	/**
+	 * Re-evaluates which attributes are bound for OnAttributeChange, according to AttributeSubscription.
+	 *
+	 * Call after changing AttributeSubscription or SubscribedAttributes at runtime.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attributes")
+	void RefreshAttributeSubscriptions();
+
+	/**
+	 * With WhenListened, binds attributes if none are bound yet and OnAttributeChange or OnCoalescedAttributeChange got a listener.
+	 *
+	 * Listeners bound after delegates are registered are picked up on the next frame, when an effect is added, before a
+	 * UGSCAttributeSetBase attribute changes and when a UGSCUserWidget is initialized. Call this right after binding to not miss
+	 * changes happening before that.
+	 */
+	void BindAttributeChangeDelegatesIfListened();
+
+	/**
+	 * When enabled, attribute changes happening during a frame are collected per attribute and broadcast once (OnAttributeChange,
+	 * OnCoalescedAttributeChange, OnHealthChange, OnStaminaChange and OnManaChange) when the component ticks in CoalescingTickGroup.
+	 *
+	 * Merged broadcasts pass the summed DeltaValue and the union of EventTags. Useful for actors receiving many modifiers per frame
+	 * (damage over time, auras, stacking buffs), as listeners run once per attribute and per frame instead of once per change.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Attributes")
+	bool bCoalesceAttributeChanges = false;
+
+	/** Tick group in which coalesced attribute changes are broadcast. Changes happening after this group are broadcast on next frame. */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Attributes", meta=(EditCondition = "bCoalesceAttributeChanges"))
+	TEnumAsByte<ETickingGroup> CoalescingTickGroup = TG_PostUpdateWork;
+
+	/** Immediately broadcasts attribute changes collected so far when bCoalesceAttributeChanges is enabled */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attributes")
+	void FlushCoalescedAttributeChanges();
+
+	/**
+	 * Maximum number of active gameplay effect handles tracked to receive stack and time change events.
+	 *
+	 * Handles are pruned as effects are removed, so this is only reached with a large number of effects active at once. Effects
+	 * added past the cap still trigger OnGameplayEffectAdded / Removed, but not OnGameplayEffectStackChange / TimeChange. 0 means no cap.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Abilities", AdvancedDisplay, meta=(ClampMin = "0"))
+	int32 MaxTrackedGameplayEffectHandles = 1024;
+
+	/** Returns the number of active gameplay effect handles currently tracked for stack and time change events */
+	int32 GetNumTrackedGameplayEffectHandles() const { return GameplayEffectAddedHandles.Num(); }
+
+	/** Returns the memory allocated to track active gameplay effect handles, in bytes */
+	SIZE_T GetTrackedGameplayEffectHandlesAllocatedSize() const { return GameplayEffectAddedHandles.GetAllocatedSize(); }
+
 	// Called from AttributeSet, and trigger BP events
 	virtual void HandleDamage(float DamageAmount, const FGameplayTagContainer& DamageTags, AActor* SourceActor);
 	virtual void HandleHealthChange(float DeltaValue, const FGameplayTagContainer& EventTags);
@@ -173,6 +253,19 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Abilities")
 	FGSCOnAttributeChange OnAttributeChange;
 
+	/**
+	* Called when any of the attributes owned by this character are changed, with both old and new values
+	*
+	* When bCoalesceAttributeChanges is enabled, this is called once per frame and per attribute, otherwise once per change.
+	*
+	* @param Attribute The Attribute that was changed
+	* @param OldValue The value before the first merged change
+	* @param NewValue The value after the last merged change
+	* @param NumChanges The number of changes merged into this event (always 1 when not coalescing)
+	*/
+	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Abilities")
+	FGSCOnCoalescedAttributeChange OnCoalescedAttributeChange;
+
 
 	// Generic Attribute change callback for attributes
 	virtual void OnAttributeChanged(const FOnAttributeChangeData& Data);
@@ -287,6 +380,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Abilities")
 	virtual TArray<UGameplayAbility*> GetActiveAbilitiesByTags(const FGameplayTagContainer GameplayTagContainer) const;
 
+	/**
+	* Visits currently active ability instances of the given class (or a child class), without copying ability specs or allocating.
+	*
+	* Backed by an index of active instances maintained from ASC ability activated / ended callbacks. Return false from Visitor to stop iterating.
+	*
+	* @param AbilityClass The Gameplay Ability Class to search for
+	* @param Visitor Called for each matching active instance
+	*/
+	void ForEachActiveAbilityByClass(TSubclassOf<UGameplayAbility> AbilityClass, TFunctionRef<bool(UGameplayAbility*)> Visitor) const;
+
+	/**
+	* Visits currently active ability instances whose asset tags match all of the given tags, without allocating.
+	*
+	* @param GameplayTagContainer The Ability Tags to search for
+	* @param Visitor Called for each matching active instance, return false to stop iterating
+	*/
+	void ForEachActiveAbilityByTags(const FGameplayTagContainer& GameplayTagContainer, TFunctionRef<bool(UGameplayAbility*)> Visitor) const;
+
+	/** Returns the first currently active ability instance of the given class (or a child class), or nullptr. Does not allocate. */
+	UGameplayAbility* GetFirstActiveAbilityByClass(TSubclassOf<UGameplayAbility> AbilityClass) const;
+
 	/**
 	* Attempts to activate the ability that is passed in. This will check costs and requirements before doing so.
 	*
@@ -437,13 +551,27 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability")
 	FGSCOnCooldownChanged OnCooldownStart;
 
-	/** Called when a cooldown gameplay tag is removed, meaning cooldown expired */
+	/** Called when a cooldown expired, once per cooldown gameplay tag */
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Ability")
 	FGSCOnCooldownEnd OnCooldownEnd;
 
+	/** Returns the time remaining before the cooldown of an ability ends, or 0 if the ability is not on cooldown */
+	UFUNCTION(BlueprintPure, Category="GAS Companion|Ability")
+	float GetCooldownTimeRemaining(FGameplayAbilitySpecHandle AbilitySpecHandle) const;
+
+	/** Returns the remaining fraction (1 when just started, 0 when over) of the cooldown of an ability, or 0 if the ability is not on cooldown */
+	UFUNCTION(BlueprintPure, Category="GAS Companion|Ability")
+	float GetCooldownRemainingFraction(FGameplayAbilitySpecHandle AbilitySpecHandle) const;
+
+	/** Returns the tracker of cooldowns started since delegates were registered, which fires OnCooldownEnd */
+	const FGSCCooldownTracker& GetCooldownTracker() const { return CooldownTracker; }
+
 protected:
 	//~ Begin UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	//~ End UActorComponent interface
 
 	//~ Begin UObject interface
@@ -476,10 +604,92 @@ protected:
 	/** Manage cooldown events trigger when an ability is committed */
 	void HandleCooldownOnAbilityCommit(UGameplayAbility* ActivatedAbility);
 
+	/** Triggered by CooldownTracker when a cooldown should be over. Reschedules it if the cooldown was extended in the meantime */
+	virtual void OnCooldownExpired(const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer& CooldownTags, float Duration);
+
+	/** Returns current ASC time remaining for the cooldown of an ability, or 0 if it isn't on cooldown anymore */
+	float GetAbilityCooldownTimeRemaining(const FGameplayAbilitySpecHandle& AbilitySpecHandle, float& OutDuration) const;
+
 private:
-	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
-	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+	/** Active GE handles bound to stack / time change delegates, pruned when effects are removed and capped to MaxTrackedGameplayEffectHandles */
+	TSet<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
+
+	/** Tracks a newly added GE handle. Returns false if the cap is reached, in which case delegates shouldn't be bound for it. */
+	bool TrackGameplayEffectHandle(FActiveGameplayEffectHandle ActiveHandle);
+
+	/** Removes handles of effects no longer active on the ASC (removed while delegates were not registered) */
+	void PruneGameplayEffectHandles();
+
+	bool bWarnedTrackedGameplayEffectHandlesCap = false;
 
 	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FGameplayTag> GameplayTagBoundToDelegates;
+
+	/** Attributes currently bound to OnAttributeChanged / OnDamageAttributeChanged on OwnerAbilitySystemComponent */
+	TArray<FGameplayAttribute> BoundAttributes;
+
+	/** Binds attribute value change delegates on ASC according to AttributeSubscription */
+	void BindAttributeChangeDelegates(UAbilitySystemComponent* ASC);
+
+	/** Removes attribute value change delegates previously bound by BindAttributeChangeDelegates */
+	void UnbindAttributeChangeDelegates(UAbilitySystemComponent* ASC);
+
+	/** Attribute changes (from ASC attribute delegates) collected during the frame, when bCoalesceAttributeChanges is enabled */
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> PendingAttributeChanges;
+
+	/** Attribute changes reported by AttributeSets through HandleAttributeChange, collected during the frame */
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> PendingHandledAttributeChanges;
+
+	/** Health / Stamina / Mana changes reported by AttributeSets, collected during the frame */
+	FGSCCoalescedAttributeChange PendingHealthChange;
+	FGSCCoalescedAttributeChange PendingStaminaChange;
+	FGSCCoalescedAttributeChange PendingManaChange;
+
+	/** Maps being broadcast by FlushCoalescedAttributeChanges, swapped with pending ones so that listeners can safely change attributes */
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> FlushingAttributeChanges;
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> FlushingHandledAttributeChanges;
+
+	bool bFlushingAttributeChanges = false;
+
+	/** Running cooldowns keyed by ability spec handle, advanced from component tick */
+	FGSCCooldownTracker CooldownTracker;
+
+	/** Enables component tick, to broadcast pending attribute changes or advance CooldownTracker. Disabled again once idle. */
+	void RequestComponentTick();
+
+	bool HasPendingAttributeChanges() const;
+
+	/** Currently active ability instances, keyed by their exact class. Maintained from ASC ability activated / ended callbacks */
+	mutable TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<UGameplayAbility>, TInlineAllocator<2>>> ActiveAbilityIndex;
+
+	/** Abilities activated while ActiveAbilityIndex was being visited, added to the index once the outermost visit is done */
+	mutable TArray<TWeakObjectPtr<UGameplayAbility>, TInlineAllocator<2>> PendingActiveAbilities;
+
+	/** Nesting depth of ActiveAbilityIndex visits. While non zero, index entries are only reset and compacted afterwards */
+	mutable int32 ActiveAbilityIndexVisitDepth = 0;
+	mutable bool bActiveAbilityIndexNeedsCompaction = false;
+
+	/** Trigger by ASC when an ability is activated / ended, to keep ActiveAbilityIndex up to date */
+	void OnAbilityActivatedForIndex(UGameplayAbility* Ability);
+	void OnAbilityEndedForIndex(UGameplayAbility* Ability);
+
+	/** ASC whose ability activated / ended callbacks maintain ActiveAbilityIndex, if any */
+	TWeakObjectPtr<const UAbilitySystemComponent> ActiveAbilityIndexASC;
+
+	/** Resets ActiveAbilityIndex and fills it with abilities already running on ASC */
+	void ResetActiveAbilityIndex(const UAbilitySystemComponent* ASC);
+
+	/**
+	 * Visits active instances whose class passes ClassFilter.
+	 *
+	 * Uses ActiveAbilityIndex when it is maintained for OwnerAbilitySystemComponent, otherwise (eg. RegisterAbilitySystemDelegates() not called)
+	 * scans OwnerAbilitySystemComponent activatable abilities.
+	 */
+	void VisitActiveAbilities(TFunctionRef<bool(const UClass*)> ClassFilter, TFunctionRef<bool(UGameplayAbility*)> Visitor) const;
+
+	/** Visits active instances in ActiveAbilityIndex whose class passes ClassFilter, deferring index mutations triggered by Visitor */
+	void VisitActiveAbilityIndex(TFunctionRef<bool(const UClass*)> ClassFilter, TFunctionRef<bool(UGameplayAbility*)> Visitor) const;
+
+	/** Applies index mutations deferred during a visit */
+	void FlushActiveAbilityIndex() const;
 };
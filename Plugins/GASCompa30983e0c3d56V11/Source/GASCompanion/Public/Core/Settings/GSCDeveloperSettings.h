@@ -25,6 +25,15 @@ public:
 	 */
 	UPROPERTY(config, EditAnywhere, Category = "Attributes", meta = (DisplayName = "Hide GSCAttributeSet Attributes"))
 	bool bHideGSCAttributeSetInDetailsView = false;
+
+	/**
+	 * Set this setting to true to create the GSC Attribute Store subsystem in game worlds.
+	 *
+	 * The store keeps GSCAttributeSet attributes of lightweight entities (eg. large waves of simple enemies) in contiguous arrays,
+	 * without an ASC and attribute set per actor. See UGSCAttributeStoreSubsystem.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Attributes", meta = (DisplayName = "Enable Attribute Store"))
+	bool bEnableAttributeStore = false;
 	
 	/**
 	 * True if the GAS Companion module should add combo button and its drop-down menu in the level editor toolbar.
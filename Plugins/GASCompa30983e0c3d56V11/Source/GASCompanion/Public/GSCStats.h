@@ -0,0 +1,8 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GAS Companion"), STATGROUP_GASCompanion, STATCAT_Advanced);
@@ -0,0 +1,182 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GSCAttributeStoreSubsystem.generated.h"
+
+/** Handle to an entity of UGSCAttributeStoreSubsystem. Handles of removed entities are never valid again. */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCAttributeStoreHandle
+{
+	GENERATED_BODY()
+
+	FGSCAttributeStoreHandle() = default;
+
+	FGSCAttributeStoreHandle(const int32 InSlot, const int32 InSerial)
+		: Slot(InSlot)
+		, Serial(InSerial)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return Slot != INDEX_NONE;
+	}
+
+	bool operator==(const FGSCAttributeStoreHandle& Other) const
+	{
+		return Slot == Other.Slot && Serial == Other.Serial;
+	}
+
+	bool operator!=(const FGSCAttributeStoreHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend uint32 GetTypeHash(const FGSCAttributeStoreHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Slot), ::GetTypeHash(Handle.Serial));
+	}
+
+private:
+	friend class UGSCAttributeStoreSubsystem;
+
+	int32 Slot = INDEX_NONE;
+	int32 Serial = 0;
+};
+
+/**
+ * World Subsystem storing GSCAttributeSet attributes (Health, Stamina, Mana, their max and regen rate) of lightweight entities,
+ * for games spawning enemies by the hundreds where an ASC and attribute sets per actor are too costly.
+ *
+ * Each attribute is kept in its own contiguous array, indexed through entity handles, and regeneration / damage run as loops over
+ * those arrays (across task threads for large entity counts). Entities have no gameplay effects, so base and current values are
+ * the same, and attributes aren't replicated.
+ *
+ * Only created when enabled in GAS Companion developer settings (bEnableAttributeStore).
+ */
+UCLASS(DisplayName = "GSC Attribute Store")
+class GASCOMPANION_API UGSCAttributeStoreSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Whether regeneration is applied on each tick */
+	UPROPERTY(BlueprintReadWrite, Category = "GAS Companion|Attribute Store")
+	bool bTickRegeneration = true;
+
+	/** Entity count from which regeneration is split across task threads. 0 to always run on the calling thread. Damage always runs on the calling thread. */
+	UPROPERTY(BlueprintReadWrite, Category = "GAS Companion|Attribute Store", meta = (ClampMin = 0))
+	int32 ParallelEntityThreshold = 4096;
+
+	//~ Begin USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+	/** Returns whether Attribute is stored, ie. one of GSCAttributeSet Health, Stamina and Mana attributes (with their max and regen rate) */
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Attribute Store")
+	static bool IsStoredAttribute(FGameplayAttribute Attribute);
+
+	/** Adds an entity with all of its attributes set to 0 */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attribute Store")
+	FGSCAttributeStoreHandle AddEntity();
+
+	/** Removes an entity, invalidating its handle */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attribute Store")
+	void RemoveEntity(FGSCAttributeStoreHandle Handle);
+
+	/** Returns whether Handle refers to an entity of this store */
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Attribute Store")
+	bool IsValidEntity(FGSCAttributeStoreHandle Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Attribute Store")
+	int32 GetNumEntities() const
+	{
+		return DenseToSlot.Num();
+	}
+
+	/** Returns the value of an attribute, or 0 if the entity or attribute isn't stored. Mirrors UGSCCoreComponent::GetCurrentAttributeValue */
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Attribute Store")
+	float GetCurrentAttributeValue(FGSCAttributeStoreHandle Handle, FGameplayAttribute Attribute) const;
+
+	/**
+	 * Sets the value of an attribute. Mirrors UAbilitySystemComponent::SetNumericAttributeBase.
+	 *
+	 * Like UGSCAttributeSet, changing a max attribute scales the current value to keep the same ratio.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Attribute Store")
+	void SetAttributeBase(FGSCAttributeStoreHandle Handle, FGameplayAttribute Attribute, float NewValue);
+
+	/** Adds regen rate * DeltaTime to Health, Stamina and Mana of every entity, clamped to their max. Entities at 0 Health are dead and don't regenerate Health. */
+	void ApplyRegeneration(float DeltaTime);
+
+	/**
+	 * Removes Damage from Health of each entity, clamped to 0. Invalid handles are skipped.
+	 *
+	 * @param OutDeadEntities If set, filled with entities whose Health reached 0 with this damage
+	 */
+	void ApplyDamage(TConstArrayView<FGSCAttributeStoreHandle> Handles, float Damage, TArray<FGSCAttributeStoreHandle>* OutDeadEntities = nullptr);
+
+	/** Returns the memory allocated for entities, in bytes */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Stored attributes, one array each */
+	enum class EColumn : uint8
+	{
+		Health,
+		MaxHealth,
+		HealthRegenRate,
+		Stamina,
+		MaxStamina,
+		StaminaRegenRate,
+		Mana,
+		MaxMana,
+		ManaRegenRate,
+		Num
+	};
+
+	static constexpr int32 NumColumns = static_cast<int32>(EColumn::Num);
+
+	struct FSlot
+	{
+		int32 DenseIndex = INDEX_NONE;
+		int32 Serial = 0;
+	};
+
+	/** Attribute values, indexed by dense entity index. Entities are kept packed, the last one moving into the place of a removed one */
+	TArray<float> Columns[NumColumns];
+
+	/** Slot of each dense entity index */
+	TArray<int32> DenseToSlot;
+
+	/** Dense entity index of each handle slot, INDEX_NONE for free slots */
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	static int32 GetColumnIndex(const FGameplayAttribute& Attribute);
+
+	/** Returns the dense index of an entity, or INDEX_NONE if the handle is stale */
+	int32 GetDenseIndex(FGSCAttributeStoreHandle Handle) const;
+
+	TArray<float>& GetColumn(EColumn Column)
+	{
+		return Columns[static_cast<int32>(Column)];
+	}
+
+	/** Adds Rate * DeltaTime to Value, clamped to Max, for entities in [First, First + Num) */
+	static void Regenerate(float* RESTRICT Values, const float* RESTRICT MaxValues, const float* RESTRICT Rates, int32 First, int32 Num, float DeltaTime);
+
+	/** Same as Regenerate, but values at 0 are left there */
+	static void RegenerateNonDepleted(float* RESTRICT Values, const float* RESTRICT MaxValues, const float* RESTRICT Rates, int32 First, int32 Num, float DeltaTime);
+};
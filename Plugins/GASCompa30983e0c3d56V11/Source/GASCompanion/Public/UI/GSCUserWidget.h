@@ -7,6 +7,7 @@
 #include "AttributeSet.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffectTypes.h"
+#include "Abilities/GSCTypes.h"
 #include "GSCUserWidget.generated.h"
 
 class UGSCCoreComponent;
@@ -95,6 +96,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|UI")
 	virtual void InitializeWithAbilitySystem(UPARAM(ref) const UAbilitySystemComponent* AbilitySystemComponent);
 
+	/**
+	 * When enabled, attribute changes happening during a frame are merged per attribute and OnAttributeChange is triggered once
+	 * on next timer manager tick, with the value before the first change and the value after the last one.
+	 *
+	 * Reduces Blueprint and widget update cost when many modifiers hit the same attribute in a single frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GAS Companion|UI")
+	bool bCoalesceAttributeChanges = false;
+
 	/** Clears off any ASC delegates and dispose AbilitySystemComponent pointer */
 	void ResetAbilitySystem();
 	
@@ -115,6 +125,10 @@ public:
 	/** Event triggered whenever an attribute value is changed on Owner Actor's ASC */
 	UFUNCTION(BlueprintImplementableEvent, Category = "GAS Companion|UI")
 	void OnAttributeChange(FGameplayAttribute Attribute, float NewValue, float OldValue);
+
+	/** Event triggered after OnAttributeChange when bCoalesceAttributeChanges is enabled, with the number of changes merged into this one */
+	UFUNCTION(BlueprintImplementableEvent, Category = "GAS Companion|UI")
+	void OnCoalescedAttributeChange(FGameplayAttribute Attribute, float NewValue, float OldValue, int32 NumChanges);
 	
 	/** Event triggered by Companion Core Component whenever a gameplay effect is added / removed */
 	UFUNCTION(BlueprintImplementableEvent, Category = "GAS Companion|UI")
@@ -159,6 +173,12 @@ public:
 	/** Triggered by ASC and handle / broadcast Attributes change */
 	virtual void OnAttributeChanged(const FOnAttributeChangeData& Data);
 
+	/**
+	 * Triggers OnAttributeChange / OnCoalescedAttributeChange / HandleAttributeChange for attribute changes merged so far when
+	 * bCoalesceAttributeChanges is enabled. Attributes whose merged changes cancelled each other out are skipped.
+	 */
+	void FlushCoalescedAttributeChanges();
+
 	/** Triggered by ASC when GEs are added */
 	virtual void OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, FActiveGameplayEffectHandle ActiveHandle);
 
@@ -218,4 +238,12 @@ private:
 
 	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FGameplayTag> GameplayTagBoundToDelegates;
+
+	/** Attribute changes merged since last flush, when bCoalesceAttributeChanges is enabled */
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> PendingAttributeChanges;
+
+	/** Changes being triggered by FlushCoalescedAttributeChanges, swapped with PendingAttributeChanges */
+	TMap<FGameplayAttribute, FGSCCoalescedAttributeChange> FlushingAttributeChanges;
+
+	bool bAttributeChangesFlushScheduled = false;
 };
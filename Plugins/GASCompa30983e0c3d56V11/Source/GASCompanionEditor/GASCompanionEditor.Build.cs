@@ -19,6 +19,7 @@ public class GASCompanionEditor : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AIModule",
 				"AppFramework",
 				"ApplicationCore",
 				"CoreUObject",
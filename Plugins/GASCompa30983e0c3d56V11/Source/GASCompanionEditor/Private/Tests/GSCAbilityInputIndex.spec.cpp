@@ -0,0 +1,131 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilityInputIndexSpec, "GASCompanion.Runtime.GSCAbilitySystemComponent.AbilityInputIndex", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	FGSCTestWorld TestWorld;
+
+	UGSCAbilitySystemComponent* ASC = nullptr;
+
+	FGameplayAbilitySpecHandle HandleA;
+	FGameplayAbilitySpecHandle HandleB;
+
+	FGameplayAbilitySpecHandle GiveAbility(const TSubclassOf<UGameplayAbility> AbilityClass, const int32 InputID) const
+	{
+		return ASC->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, InputID));
+	}
+
+	/** Returns the handles of specs whose input got pressed by pressing InputID, releasing it afterward */
+	TArray<FGameplayAbilitySpecHandle> PressInput(const int32 InputID) const
+	{
+		ASC->AbilityLocalInputPressed(InputID);
+
+		TArray<FGameplayAbilitySpecHandle> PressedHandles;
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+		{
+			if (Spec.InputPressed)
+			{
+				PressedHandles.Add(Spec.Handle);
+			}
+		}
+
+		ASC->AbilityLocalInputReleased(InputID);
+		return PressedHandles;
+	}
+
+	void SetInputID(const FGameplayAbilitySpecHandle& Handle, const int32 InputID) const
+	{
+		FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+		check(Spec);
+		Spec->InputID = InputID;
+	}
+
+END_DEFINE_SPEC(FGSCAbilityInputIndexSpec)
+
+void FGSCAbilityInputIndexSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+
+		AActor* Actor = TestWorld.World->SpawnActor<AActor>();
+		ASC = NewObject<UGSCAbilitySystemComponent>(Actor, TEXT("AbilitySystemComponent"));
+		ASC->RegisterComponent();
+		ASC->InitAbilityActorInfo(Actor, Actor);
+
+		HandleA = GiveAbility(UGSCTestRecordingAbilityA::StaticClass(), 1);
+		HandleB = GiveAbility(UGSCTestRecordingAbilityB::StaticClass(), 2);
+	});
+
+	AfterEach([this]()
+	{
+		UGSCTestRecordingAbility::ActivationLog.Reset();
+
+		TestWorld.Destroy();
+		ASC = nullptr;
+	});
+
+	It("should only press specs bound to the input", [this]()
+	{
+		const TArray<FGameplayAbilitySpecHandle> Pressed = PressInput(1);
+		TestTrue(TEXT("Pressed A only"), Pressed.Num() == 1 && Pressed[0] == HandleA);
+		TestEqual(TEXT("Pressed unbound input"), PressInput(4).Num(), 0);
+	});
+
+	It("should press specs given and keep others after removal once the index is built", [this]()
+	{
+		PressInput(1);
+
+		const FGameplayAbilitySpecHandle HandleC = GiveAbility(UGSCTestRecordingAbilityC::StaticClass(), 1);
+		TArray<FGameplayAbilitySpecHandle> Pressed = PressInput(1);
+		TestTrue(TEXT("Pressed A and C"), Pressed.Num() == 2 && Pressed.Contains(HandleA) && Pressed.Contains(HandleC));
+
+		ASC->ClearAbility(HandleA);
+		Pressed = PressInput(1);
+		TestTrue(TEXT("Pressed C after removing A"), Pressed.Num() == 1 && Pressed[0] == HandleC);
+
+		Pressed = PressInput(2);
+		TestTrue(TEXT("Pressed B after removing A"), Pressed.Num() == 1 && Pressed[0] == HandleB);
+	});
+
+	It("should treat an unindexed input as unbound until marked dirty", [this]()
+	{
+		PressInput(2);
+
+		SetInputID(HandleB, 3);
+		TestEqual(TEXT("Pressed unindexed input"), PressInput(3).Num(), 0);
+	});
+
+	It("should pick up an InputID changed in place to an unindexed input once marked dirty", [this]()
+	{
+		PressInput(2);
+
+		SetInputID(HandleB, 3);
+		ASC->MarkAbilityInputIndexDirty();
+
+		const TArray<FGameplayAbilitySpecHandle> Pressed = PressInput(3);
+		TestTrue(TEXT("Pressed B on its new input"), Pressed.Num() == 1 && Pressed[0] == HandleB);
+		TestEqual(TEXT("Pressed B previous input"), PressInput(2).Num(), 0);
+	});
+
+	It("should drop a spec from its previous input once its InputID changed in place", [this]()
+	{
+		PressInput(1);
+
+		SetInputID(HandleA, INDEX_NONE);
+		TestEqual(TEXT("Pressed A previous input"), PressInput(1).Num(), 0);
+	});
+
+	It("should pick up an InputID changed to an indexed input once marked dirty", [this]()
+	{
+		PressInput(1);
+
+		SetInputID(HandleA, 2);
+		ASC->MarkAbilityInputIndexDirty();
+
+		const TArray<FGameplayAbilitySpecHandle> Pressed = PressInput(2);
+		TestTrue(TEXT("Pressed A and B"), Pressed.Num() == 2 && Pressed.Contains(HandleA) && Pressed.Contains(HandleB));
+	});
+}
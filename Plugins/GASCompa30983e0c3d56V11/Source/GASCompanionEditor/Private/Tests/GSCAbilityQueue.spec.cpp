@@ -0,0 +1,132 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCDelegates.h"
+#include "GSCTestTypes.h"
+#include "Components/GSCAbilityQueueComponent.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilityQueueSpec, "GASCompanion.Runtime.GSCAbilityQueueComponent", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	FGSCTestWorld TestWorld;
+
+	UGSCAbilityQueueComponent* AbilityQueueComponent = nullptr;
+
+	FDelegateHandle AllowedAbilitiesHandle;
+
+	int32 NumAllowedAbilitiesBroadcasts = 0;
+
+	const UGameplayAbility* GetAbilityCDO(const TSubclassOf<UGameplayAbility> AbilityClass) const
+	{
+		return AbilityClass->GetDefaultObject<UGameplayAbility>();
+	}
+
+END_DEFINE_SPEC(FGSCAbilityQueueSpec)
+
+void FGSCAbilityQueueSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestRecordingAbilityA::StaticClass()));
+		ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestRecordingAbilityB::StaticClass()));
+		ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestRecordingAbilityC::StaticClass()));
+
+		AbilityQueueComponent = NewObject<UGSCAbilityQueueComponent>(TestWorld.Actor, TEXT("AbilityQueueComponent"));
+		AbilityQueueComponent->RegisterComponent();
+		AbilityQueueComponent->OwnerAbilitySystemComponent = ASC;
+
+		UGSCTestRecordingAbility::ActivationLog.Reset();
+
+		NumAllowedAbilitiesBroadcasts = 0;
+		AllowedAbilitiesHandle = FGSCDelegates::OnUpdateAllowedAbilities.AddLambda([this](TArray<TSubclassOf<UGameplayAbility>>)
+		{
+			++NumAllowedAbilitiesBroadcasts;
+		});
+	});
+
+	AfterEach([this]()
+	{
+		FGSCDelegates::OnUpdateAllowedAbilities.Remove(AllowedAbilitiesHandle);
+		UGSCTestRecordingAbility::ActivationLog.Reset();
+
+		TestWorld.Destroy();
+		AbilityQueueComponent = nullptr;
+	});
+
+	It("should not tick", [this]()
+	{
+		TestFalse(TEXT("Can ever tick"), AbilityQueueComponent->PrimaryComponentTick.bCanEverTick);
+	});
+
+	It("should only broadcast allowed abilities when they change", [this]()
+	{
+		AbilityQueueComponent->OpenAbilityQueue();
+
+		AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(false);
+		TestEqual(TEXT("Broadcasts after unchanged allow all"), NumAllowedAbilitiesBroadcasts, 0);
+
+		AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ UGSCTestRecordingAbilityB::StaticClass(), UGSCTestRecordingAbilityC::StaticClass() });
+		TestEqual(TEXT("Broadcasts after first update"), NumAllowedAbilitiesBroadcasts, 1);
+
+		AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ UGSCTestRecordingAbilityC::StaticClass(), UGSCTestRecordingAbilityB::StaticClass(), UGSCTestRecordingAbilityB::StaticClass() });
+		TestEqual(TEXT("Broadcasts after same update, different order"), NumAllowedAbilitiesBroadcasts, 1);
+
+		AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ UGSCTestRecordingAbilityB::StaticClass() });
+		TestEqual(TEXT("Broadcasts after different update"), NumAllowedAbilitiesBroadcasts, 2);
+
+		AbilityQueueComponent->OnAbilityEnded(GetAbilityCDO(UGSCTestRecordingAbilityA::StaticClass()));
+		TestEqual(TEXT("Broadcasts after reset"), NumAllowedAbilitiesBroadcasts, 3);
+
+		AbilityQueueComponent->OnAbilityEnded(GetAbilityCDO(UGSCTestRecordingAbilityA::StaticClass()));
+		TestEqual(TEXT("Broadcasts after reset of empty queue"), NumAllowedAbilitiesBroadcasts, 3);
+	});
+
+	It("should replay the last allowed failed ability once the current one ends", [this]()
+	{
+		AbilityQueueComponent->OpenAbilityQueue();
+		AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ UGSCTestRecordingAbilityB::StaticClass(), UGSCTestRecordingAbilityC::StaticClass() });
+
+		const FGameplayTagContainer ReasonTags;
+		AbilityQueueComponent->OnAbilityFailed(GetAbilityCDO(UGSCTestRecordingAbilityB::StaticClass()), ReasonTags);
+		AbilityQueueComponent->OnAbilityFailed(GetAbilityCDO(UGSCTestRecordingAbilityC::StaticClass()), ReasonTags);
+		TestTrue(TEXT("Queued ability"), AbilityQueueComponent->GetCurrentQueuedAbility() == GetAbilityCDO(UGSCTestRecordingAbilityC::StaticClass()));
+
+		AbilityQueueComponent->OnAbilityEnded(GetAbilityCDO(UGSCTestRecordingAbilityA::StaticClass()));
+
+		TestEqual(TEXT("Number of activations"), UGSCTestRecordingAbility::ActivationLog.Num(), 1);
+		if (UGSCTestRecordingAbility::ActivationLog.Num() == 1)
+		{
+			TestTrue(TEXT("Activated ability"), UGSCTestRecordingAbility::ActivationLog[0] == UGSCTestRecordingAbilityC::StaticClass());
+		}
+
+		TestNull(TEXT("Queued ability after replay"), AbilityQueueComponent->GetCurrentQueuedAbility());
+		TestEqual(TEXT("Allowed abilities after replay"), AbilityQueueComponent->GetQueuedAllowedAbilities().Num(), 0);
+	});
+
+	It("should not queue abilities that are not allowed", [this]()
+	{
+		AbilityQueueComponent->OpenAbilityQueue();
+		AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ UGSCTestRecordingAbilityB::StaticClass() });
+
+		AbilityQueueComponent->OnAbilityFailed(GetAbilityCDO(UGSCTestRecordingAbilityC::StaticClass()), FGameplayTagContainer());
+		TestNull(TEXT("Queued ability"), AbilityQueueComponent->GetCurrentQueuedAbility());
+
+		AbilityQueueComponent->OnAbilityEnded(GetAbilityCDO(UGSCTestRecordingAbilityA::StaticClass()));
+		TestEqual(TEXT("Number of activations"), UGSCTestRecordingAbility::ActivationLog.Num(), 0);
+	});
+
+	It("should queue any ability when all abilities are allowed", [this]()
+	{
+		AbilityQueueComponent->OpenAbilityQueue();
+		AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(true);
+		TestEqual(TEXT("Broadcasts after allow all"), NumAllowedAbilitiesBroadcasts, 1);
+
+		AbilityQueueComponent->OnAbilityFailed(GetAbilityCDO(UGSCTestRecordingAbilityB::StaticClass()), FGameplayTagContainer());
+		AbilityQueueComponent->OnAbilityEnded(GetAbilityCDO(UGSCTestRecordingAbilityA::StaticClass()));
+
+		TestEqual(TEXT("Number of activations"), UGSCTestRecordingAbility::ActivationLog.Num(), 1);
+		TestFalse(TEXT("All abilities allowed after replay"), AbilityQueueComponent->IsAllAbilitiesAllowedForAbilityQueue());
+	});
+}
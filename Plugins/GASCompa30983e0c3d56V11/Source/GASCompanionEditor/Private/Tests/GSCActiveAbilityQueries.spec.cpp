@@ -0,0 +1,71 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCActiveAbilityQueriesSpec, "GASCompanion.Runtime.GSCCoreComponent.ActiveAbilityQueries", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	FGSCTestWorld TestWorld;
+
+	/** Core component to query, with or without ability system delegates registered */
+	UGSCCoreComponent* CoreComponent = nullptr;
+
+	/** Gives A and B abilities, activates A and checks queries before and after A is ended */
+	void TestActiveAbilityQueries()
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		const FGameplayAbilitySpecHandle HandleA = ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestRecordingAbilityA::StaticClass()));
+		ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestRecordingAbilityB::StaticClass()));
+
+		TestFalse(TEXT("Using A before activation"), CoreComponent->IsUsingAbilityByClass(UGSCTestRecordingAbilityA::StaticClass()));
+
+		ASC->TryActivateAbility(HandleA);
+
+		TestTrue(TEXT("Using A"), CoreComponent->IsUsingAbilityByClass(UGSCTestRecordingAbilityA::StaticClass()));
+		TestFalse(TEXT("Using B"), CoreComponent->IsUsingAbilityByClass(UGSCTestRecordingAbilityB::StaticClass()));
+		TestTrue(TEXT("Using base class"), CoreComponent->IsUsingAbilityByClass(UGSCTestRecordingAbility::StaticClass()));
+
+		const TArray<UGameplayAbility*> ActiveAbilities = CoreComponent->GetActiveAbilitiesByClass(UGSCTestRecordingAbility::StaticClass());
+		TestTrue(TEXT("Active abilities of base class"), ActiveAbilities.Num() == 1 && ActiveAbilities[0]->GetClass() == UGSCTestRecordingAbilityA::StaticClass());
+
+		// An empty query matches nothing, like the engine's own tag query
+		TestEqual(TEXT("Active abilities with an empty tag container"), CoreComponent->GetActiveAbilitiesByTags(FGameplayTagContainer()).Num(), 0);
+		TestFalse(TEXT("Using ability with an empty tag container"), CoreComponent->IsUsingAbilityByTags(FGameplayTagContainer()));
+
+		ASC->CancelAbilityHandle(HandleA);
+
+		TestFalse(TEXT("Using A after cancel"), CoreComponent->IsUsingAbilityByClass(UGSCTestRecordingAbilityA::StaticClass()));
+		TestEqual(TEXT("Active abilities after cancel"), CoreComponent->GetActiveAbilitiesByClass(UGSCTestRecordingAbility::StaticClass()).Num(), 0);
+	}
+
+END_DEFINE_SPEC(FGSCActiveAbilityQueriesSpec)
+
+void FGSCActiveAbilityQueriesSpec::Define()
+{
+	AfterEach([this]()
+	{
+		UGSCTestRecordingAbility::ActivationLog.Reset();
+
+		TestWorld.Destroy();
+		CoreComponent = nullptr;
+	});
+
+	It("should find active abilities through the index with ability system delegates registered", [this]()
+	{
+		TestWorld.Create(true);
+		CoreComponent = TestWorld.CoreComponent;
+
+		TestActiveAbilityQueries();
+	});
+
+	It("should find active abilities from the ASC specs without ability system delegates registered", [this]()
+	{
+		TestWorld.Create(false);
+
+		CoreComponent = NewObject<UGSCCoreComponent>(TestWorld.Actor, TEXT("CoreComponent"));
+		CoreComponent->RegisterComponent();
+		CoreComponent->SetupOwner();
+
+		TestActiveAbilityQueries();
+	});
+}
@@ -0,0 +1,104 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCAttributeCoalescingSpec, "GASCompanion.Runtime.GSCCoreComponent.AttributeCoalescing", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumApplications = 10;
+
+	FGSCTestWorld TestWorld;
+
+	UGSCTestAttributeListener* Listener = nullptr;
+
+	FGameplayAttribute Attribute;
+
+	void CreateWorld(const bool bCoalesce)
+	{
+		TestWorld.Create(true, [bCoalesce](UGSCCoreComponent* CoreComponent)
+		{
+			CoreComponent->bCoalesceAttributeChanges = bCoalesce;
+		});
+
+		Listener = NewObject<UGSCTestAttributeListener>(TestWorld.Actor);
+		TestWorld.CoreComponent->OnAttributeChange.AddDynamic(Listener, &UGSCTestAttributeListener::OnAttributeChange);
+		TestWorld.CoreComponent->OnCoalescedAttributeChange.AddDynamic(Listener, &UGSCTestAttributeListener::OnCoalescedAttributeChange);
+
+		Attribute = TestWorld.Attributes[0];
+	}
+
+	/** Applies NumApplications instant effects adding Magnitude to Attribute, within the same frame */
+	void ApplyEffects(const float Magnitude) const
+	{
+		const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCCoalescingEffect"), { Attribute }, Magnitude);
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+
+		for (int32 Index = 0; Index < NumApplications; ++Index)
+		{
+			ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+		}
+	}
+
+END_DEFINE_SPEC(FGSCAttributeCoalescingSpec)
+
+void FGSCAttributeCoalescingSpec::Define()
+{
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Listener = nullptr;
+	});
+
+	It("should broadcast every change when coalescing is disabled", [this]()
+	{
+		CreateWorld(false);
+		ApplyEffects(1.f);
+
+		TestEqual(TEXT("Number of changes"), Listener->NumChanges, NumApplications);
+		TestEqual(TEXT("Number of coalesced changes"), Listener->NumCoalescedChanges, NumApplications);
+		TestEqual(TEXT("Merged changes per event"), Listener->LastNumMergedChanges, 1);
+	});
+
+	It("should broadcast a single merged change per attribute on tick", [this]()
+	{
+		CreateWorld(true);
+		ApplyEffects(1.f);
+
+		TestEqual(TEXT("Number of changes before tick"), Listener->NumChanges, 0);
+
+		TestWorld.Tick(0.1f);
+
+		TestEqual(TEXT("Number of changes"), Listener->NumChanges, 1);
+		TestEqual(TEXT("Merged delta"), Listener->LastDeltaPerAttribute.FindRef(Attribute), static_cast<float>(NumApplications));
+		TestEqual(TEXT("Number of coalesced changes"), Listener->NumCoalescedChanges, 1);
+		TestEqual(TEXT("Merged changes"), Listener->LastNumMergedChanges, NumApplications);
+		TestEqual(TEXT("Old value"), Listener->LastOldValue, 0.f);
+		TestEqual(TEXT("New value"), Listener->LastNewValue, static_cast<float>(NumApplications));
+
+		TestWorld.Tick(0.1f);
+		TestEqual(TEXT("Number of changes after another tick"), Listener->NumChanges, 1);
+	});
+
+	It("should broadcast pending changes when flushed explicitly", [this]()
+	{
+		CreateWorld(true);
+		ApplyEffects(2.f);
+
+		TestWorld.CoreComponent->FlushCoalescedAttributeChanges();
+
+		TestEqual(TEXT("Number of coalesced changes"), Listener->NumCoalescedChanges, 1);
+		TestEqual(TEXT("New value"), Listener->LastNewValue, 2.f * NumApplications);
+	});
+
+	It("should not broadcast changes cancelling each other out", [this]()
+	{
+		CreateWorld(true);
+		ApplyEffects(1.f);
+		ApplyEffects(-1.f);
+
+		TestWorld.CoreComponent->FlushCoalescedAttributeChanges();
+
+		TestEqual(TEXT("Number of changes"), Listener->NumChanges, 0);
+		TestEqual(TEXT("Number of coalesced changes"), Listener->NumCoalescedChanges, 0);
+	});
+}
@@ -0,0 +1,284 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "Subsystems/GSCAttributeStoreSubsystem.h"
+
+BEGIN_DEFINE_SPEC(FGSCAttributeStoreSpec, "GASCompanion.Runtime.GSCAttributeStoreSubsystem", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumFrames = 60;
+	static constexpr float DeltaTime = 1.f / 60.f;
+
+	FGSCTestWorld TestWorld;
+	UGSCAttributeStoreSubsystem* Store = nullptr;
+	bool bPreviousEnableAttributeStore = false;
+
+	/** Attribute values of a regenerating enemy, set on both the store and ASCs */
+	static TArray<TPair<FGameplayAttribute, float>> GetEnemyAttributes()
+	{
+		return {
+			{ UGSCAttributeSet::GetMaxHealthAttribute(), 100.f },
+			{ UGSCAttributeSet::GetHealthAttribute(), 10.f },
+			{ UGSCAttributeSet::GetHealthRegenRateAttribute(), 5.f },
+			{ UGSCAttributeSet::GetMaxStaminaAttribute(), 50.f },
+			{ UGSCAttributeSet::GetStaminaAttribute(), 10.f },
+			{ UGSCAttributeSet::GetStaminaRegenRateAttribute(), 2.f },
+			{ UGSCAttributeSet::GetMaxManaAttribute(), 20.f },
+			{ UGSCAttributeSet::GetManaAttribute(), 0.f },
+			{ UGSCAttributeSet::GetManaRegenRateAttribute(), 1.f },
+		};
+	}
+
+	FGSCAttributeStoreHandle AddEnemy() const
+	{
+		const FGSCAttributeStoreHandle Handle = Store->AddEntity();
+		for (const TPair<FGameplayAttribute, float>& Attribute : GetEnemyAttributes())
+		{
+			Store->SetAttributeBase(Handle, Attribute.Key, Attribute.Value);
+		}
+
+		return Handle;
+	}
+
+	/** Size of an object, along with memory allocated by its properties */
+	static SIZE_T GetObjectSize(UObject* Object)
+	{
+		FArchiveCountMem CountMem(Object);
+		return Object->GetClass()->GetStructureSize() + CountMem.GetMax();
+	}
+
+	/** What regenerating GSCAttributeSet attributes on each frame costs with an ASC per enemy */
+	static void RegenerateWithAbilitySystemComponent(UAbilitySystemComponent* ASC, const FGameplayAttribute& Attribute, const FGameplayAttribute& MaxAttribute, const FGameplayAttribute& RegenRateAttribute)
+	{
+		const float NewValue = ASC->GetNumericAttributeBase(Attribute) + ASC->GetNumericAttribute(RegenRateAttribute) * DeltaTime;
+		ASC->SetNumericAttributeBase(Attribute, FMath::Clamp(NewValue, 0.f, ASC->GetNumericAttribute(MaxAttribute)));
+	}
+
+	/** Reports memory per enemy and per frame regeneration cost with NumEnemies, for the store and the ASC path */
+	void RunBenchmark(const int32 NumEnemies)
+	{
+		TArray<UAbilitySystemComponent*> ASCs;
+		SIZE_T AbilitySystemSize = 0;
+		for (int32 Index = 0; Index < NumEnemies; ++Index)
+		{
+			AActor* Actor = TestWorld.World->SpawnActor<AActor>();
+
+			UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Actor, TEXT("AbilitySystemComponent"));
+			ASC->RegisterComponent();
+			UGSCAttributeSet* AttributeSet = NewObject<UGSCAttributeSet>(Actor);
+			ASC->AddSpawnedAttribute(AttributeSet);
+			ASC->InitAbilityActorInfo(Actor, Actor);
+
+			for (const TPair<FGameplayAttribute, float>& Attribute : GetEnemyAttributes())
+			{
+				ASC->SetNumericAttributeBase(Attribute.Key, Attribute.Value);
+			}
+
+			AbilitySystemSize += GetObjectSize(ASC) + GetObjectSize(AttributeSet);
+			ASCs.Add(ASC);
+			AddEnemy();
+		}
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (UAbilitySystemComponent* ASC : ASCs)
+			{
+				RegenerateWithAbilitySystemComponent(ASC, UGSCAttributeSet::GetHealthAttribute(), UGSCAttributeSet::GetMaxHealthAttribute(), UGSCAttributeSet::GetHealthRegenRateAttribute());
+				RegenerateWithAbilitySystemComponent(ASC, UGSCAttributeSet::GetStaminaAttribute(), UGSCAttributeSet::GetMaxStaminaAttribute(), UGSCAttributeSet::GetStaminaRegenRateAttribute());
+				RegenerateWithAbilitySystemComponent(ASC, UGSCAttributeSet::GetManaAttribute(), UGSCAttributeSet::GetMaxManaAttribute(), UGSCAttributeSet::GetManaRegenRateAttribute());
+			}
+		}
+		const double AbilitySystemMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+
+		Store->ParallelEntityThreshold = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Store->ApplyRegeneration(DeltaTime);
+		}
+		const double StoreMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+
+		Store->ParallelEntityThreshold = 1;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Store->ApplyRegeneration(DeltaTime);
+		}
+		const double ParallelStoreMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+
+		TestEqual(TEXT("Number of entities"), Store->GetNumEntities(), NumEnemies);
+
+		AddInfo(FString::Printf(TEXT("%d enemies: ASC + attribute set %.0f B and %.3f ms per frame, store %.1f B and %.3f ms per frame (%.3f ms across tasks)"),
+			NumEnemies,
+			static_cast<double>(AbilitySystemSize) / NumEnemies, AbilitySystemMs,
+			static_cast<double>(Store->GetAllocatedSize()) / NumEnemies, StoreMs, ParallelStoreMs));
+	}
+
+END_DEFINE_SPEC(FGSCAttributeStoreSpec)
+
+void FGSCAttributeStoreSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		bPreviousEnableAttributeStore = UGSCDeveloperSettings::Get().bEnableAttributeStore;
+		UGSCDeveloperSettings::GetMutable().bEnableAttributeStore = true;
+
+		TestWorld.Create(false);
+		Store = TestWorld.World->GetSubsystem<UGSCAttributeStoreSubsystem>();
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Store = nullptr;
+
+		UGSCDeveloperSettings::GetMutable().bEnableAttributeStore = bPreviousEnableAttributeStore;
+	});
+
+	It("should only be created when enabled in developer settings", [this]()
+	{
+		TestNotNull(TEXT("Store"), Store);
+		TestWorld.Destroy();
+
+		UGSCDeveloperSettings::GetMutable().bEnableAttributeStore = false;
+		TestWorld.Create(false);
+		TestNull(TEXT("Store when disabled"), TestWorld.World->GetSubsystem<UGSCAttributeStoreSubsystem>());
+	});
+
+	It("should keep attribute values of remaining entities when removing one", [this]()
+	{
+		if (!TestNotNull(TEXT("Store"), Store))
+		{
+			return;
+		}
+
+		const FGameplayAttribute Health = UGSCAttributeSet::GetHealthAttribute();
+
+		TArray<FGSCAttributeStoreHandle> Handles;
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			Handles.Add(Store->AddEntity());
+			Store->SetAttributeBase(Handles[Index], UGSCAttributeSet::GetMaxHealthAttribute(), 100.f);
+			Store->SetAttributeBase(Handles[Index], Health, Index + 1.f);
+		}
+
+		Store->RemoveEntity(Handles[0]);
+		TestFalse(TEXT("Removed entity is valid"), Store->IsValidEntity(Handles[0]));
+		TestEqual(TEXT("Removed entity health"), Store->GetCurrentAttributeValue(Handles[0], Health), 0.f);
+		TestEqual(TEXT("Second entity health"), Store->GetCurrentAttributeValue(Handles[1], Health), 2.f);
+		TestEqual(TEXT("Third entity health"), Store->GetCurrentAttributeValue(Handles[2], Health), 3.f);
+
+		const FGSCAttributeStoreHandle Reused = Store->AddEntity();
+		TestTrue(TEXT("New handle differs from the removed one"), Reused != Handles[0]);
+		TestFalse(TEXT("Removed entity is valid after adding another"), Store->IsValidEntity(Handles[0]));
+		TestEqual(TEXT("New entity health"), Store->GetCurrentAttributeValue(Reused, Health), 0.f);
+		TestEqual(TEXT("Number of entities"), Store->GetNumEntities(), 3);
+	});
+
+	It("should mirror GSCAttributeSet attribute getters and setters", [this]()
+	{
+		if (!TestNotNull(TEXT("Store"), Store))
+		{
+			return;
+		}
+
+		const FGSCAttributeStoreHandle Handle = AddEnemy();
+		TestEqual(TEXT("Health"), Store->GetCurrentAttributeValue(Handle, UGSCAttributeSet::GetHealthAttribute()), 10.f);
+		TestEqual(TEXT("Stamina regen rate"), Store->GetCurrentAttributeValue(Handle, UGSCAttributeSet::GetStaminaRegenRateAttribute()), 2.f);
+
+		// Same ratio as UGSCAttributeSet::AdjustAttributeForMaxChange
+		Store->SetAttributeBase(Handle, UGSCAttributeSet::GetMaxHealthAttribute(), 200.f);
+		TestEqual(TEXT("Health after max health change"), Store->GetCurrentAttributeValue(Handle, UGSCAttributeSet::GetHealthAttribute()), 20.f);
+
+		TestFalse(TEXT("Damage is stored"), UGSCAttributeStoreSubsystem::IsStoredAttribute(UGSCAttributeSet::GetDamageAttribute()));
+		Store->SetAttributeBase(Handle, UGSCAttributeSet::GetDamageAttribute(), 10.f);
+		TestEqual(TEXT("Damage"), Store->GetCurrentAttributeValue(Handle, UGSCAttributeSet::GetDamageAttribute()), 0.f);
+	});
+
+	It("should regenerate up to max values, on the calling thread or across tasks", [this]()
+	{
+		if (!TestNotNull(TEXT("Store"), Store))
+		{
+			return;
+		}
+
+		TArray<FGSCAttributeStoreHandle> Handles;
+		for (int32 Index = 0; Index < 3000; ++Index)
+		{
+			Handles.Add(AddEnemy());
+		}
+
+		Store->ParallelEntityThreshold = 0;
+		Store->ApplyRegeneration(1.f);
+		TestEqual(TEXT("Health"), Store->GetCurrentAttributeValue(Handles[0], UGSCAttributeSet::GetHealthAttribute()), 15.f);
+		TestEqual(TEXT("Mana"), Store->GetCurrentAttributeValue(Handles[0], UGSCAttributeSet::GetManaAttribute()), 1.f);
+
+		Store->ParallelEntityThreshold = 1;
+		Store->ApplyRegeneration(1.f);
+		for (const FGSCAttributeStoreHandle& Handle : Handles)
+		{
+			if (!TestEqual(TEXT("Health across tasks"), Store->GetCurrentAttributeValue(Handle, UGSCAttributeSet::GetHealthAttribute()), 20.f))
+			{
+				break;
+			}
+		}
+
+		Store->ApplyRegeneration(100.f);
+		TestEqual(TEXT("Clamped health"), Store->GetCurrentAttributeValue(Handles.Last(), UGSCAttributeSet::GetHealthAttribute()), 100.f);
+		TestEqual(TEXT("Clamped stamina"), Store->GetCurrentAttributeValue(Handles.Last(), UGSCAttributeSet::GetStaminaAttribute()), 50.f);
+	});
+
+	It("should apply damage and report entities reaching 0 health", [this]()
+	{
+		if (!TestNotNull(TEXT("Store"), Store))
+		{
+			return;
+		}
+
+		const FGSCAttributeStoreHandle Weak = AddEnemy();
+		const FGSCAttributeStoreHandle Strong = AddEnemy();
+		Store->SetAttributeBase(Strong, UGSCAttributeSet::GetHealthAttribute(), 100.f);
+
+		const FGSCAttributeStoreHandle Removed = AddEnemy();
+		Store->RemoveEntity(Removed);
+
+		TArray<FGSCAttributeStoreHandle> DeadEntities;
+		Store->ApplyDamage({ Weak, Strong, Removed }, 30.f, &DeadEntities);
+
+		TestEqual(TEXT("Weak entity health"), Store->GetCurrentAttributeValue(Weak, UGSCAttributeSet::GetHealthAttribute()), 0.f);
+		TestEqual(TEXT("Strong entity health"), Store->GetCurrentAttributeValue(Strong, UGSCAttributeSet::GetHealthAttribute()), 70.f);
+		TestTrue(TEXT("Dead entities"), DeadEntities.Num() == 1 && DeadEntities[0] == Weak);
+
+		DeadEntities.Reset();
+		Store->ApplyDamage({ Weak }, 30.f, &DeadEntities);
+		TestEqual(TEXT("Dead entities after damaging a dead entity"), DeadEntities.Num(), 0);
+
+		Store->ApplyRegeneration(1.f);
+		TestEqual(TEXT("Dead entity health after regeneration"), Store->GetCurrentAttributeValue(Weak, UGSCAttributeSet::GetHealthAttribute()), 0.f);
+		TestEqual(TEXT("Dead entity mana after regeneration"), Store->GetCurrentAttributeValue(Weak, UGSCAttributeSet::GetManaAttribute()), 1.f);
+		TestEqual(TEXT("Strong entity health after regeneration"), Store->GetCurrentAttributeValue(Strong, UGSCAttributeSet::GetHealthAttribute()), 75.f);
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report memory per enemy and regeneration cost per frame for 1k enemies", [this]()
+		{
+			if (TestNotNull(TEXT("Store"), Store))
+			{
+				RunBenchmark(1000);
+			}
+		});
+
+		It("should report memory per enemy and regeneration cost per frame for 10k enemies", [this]()
+		{
+			if (TestNotNull(TEXT("Store"), Store))
+			{
+				RunBenchmark(10000);
+			}
+		});
+	});
+}
@@ -0,0 +1,151 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCAttributeSubscriptionSpec, "GASCompanion.Runtime.GSCCoreComponent.AttributeSubscription", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumPeriodicEffects = 10000;
+
+	FGSCTestWorld TestWorld;
+
+	UGSCTestAttributeListener* Listener = nullptr;
+
+	void CreateWorld(const EGSCAttributeSubscription Subscription, const TArray<FGameplayAttribute>& SubscribedAttributes = {})
+	{
+		TestWorld.Create(true, [Subscription, &SubscribedAttributes](UGSCCoreComponent* CoreComponent)
+		{
+			CoreComponent->AttributeSubscription = Subscription;
+			CoreComponent->SubscribedAttributes = SubscribedAttributes;
+		});
+
+		Listener = NewObject<UGSCTestAttributeListener>(TestWorld.Actor);
+	}
+
+	void BindListener() const
+	{
+		TestWorld.CoreComponent->OnAttributeChange.AddDynamic(Listener, &UGSCTestAttributeListener::OnAttributeChange);
+	}
+
+	/**
+	 * Applies NumPeriodicEffects periodic effects (executed on application) modifying every attribute, then ticks one period so
+	 * that all of them execute again. Returns the elapsed time in milliseconds.
+	 */
+	double RunPeriodicEffects() const
+	{
+		const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCPeriodicBenchmarkEffect"), TestWorld.Attributes, 1.f, EGameplayEffectDurationType::Infinite, 1.f);
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumPeriodicEffects; ++Index)
+		{
+			ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+		}
+
+		TestWorld.Tick(1.f);
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+END_DEFINE_SPEC(FGSCAttributeSubscriptionSpec)
+
+void FGSCAttributeSubscriptionSpec::Define()
+{
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Listener = nullptr;
+	});
+
+	Describe("AllAttributes", [this]()
+	{
+		It("should broadcast OnAttributeChange for every attribute", [this]()
+		{
+			CreateWorld(EGSCAttributeSubscription::AllAttributes);
+			BindListener();
+
+			const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCInstantEffect"), TestWorld.Attributes, 1.f);
+			TestWorld.AbilitySystemComponent->ApplyGameplayEffectToSelf(Effect, 1.f, TestWorld.AbilitySystemComponent->MakeEffectContext());
+
+			TestEqual(TEXT("Number of changes"), Listener->NumChanges, UGSCTestAttributeSet::NumAttributes);
+		});
+	});
+
+	Describe("SubscribedAttributes", [this]()
+	{
+		It("should only broadcast OnAttributeChange for subscribed attributes", [this]()
+		{
+			TArray<FGameplayAttribute> AllAttributes;
+			UGSCBlueprintFunctionLibrary::GetAllAttributes(UGSCTestAttributeSet::StaticClass(), AllAttributes);
+
+			const TArray<FGameplayAttribute> Subscribed = { AllAttributes[0], AllAttributes[7] };
+			CreateWorld(EGSCAttributeSubscription::SubscribedAttributes, Subscribed);
+			BindListener();
+
+			const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCInstantEffect"), TestWorld.Attributes, 1.f);
+			TestWorld.AbilitySystemComponent->ApplyGameplayEffectToSelf(Effect, 1.f, TestWorld.AbilitySystemComponent->MakeEffectContext());
+
+			TestEqual(TEXT("Number of changes"), Listener->NumChanges, Subscribed.Num());
+			for (const FGameplayAttribute& Attribute : Subscribed)
+			{
+				TestEqual(FString::Printf(TEXT("Changes for %s"), *Attribute.GetName()), Listener->NumChangesPerAttribute.FindRef(Attribute), 1);
+			}
+		});
+	});
+
+	Describe("WhenListened", [this]()
+	{
+		It("should bind attributes on next frame for a listener bound after registration", [this]()
+		{
+			CreateWorld(EGSCAttributeSubscription::WhenListened);
+			BindListener();
+
+			const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCInstantEffect"), TestWorld.Attributes, 1.f);
+			UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+
+			ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+			TestEqual(TEXT("Number of changes before next frame"), Listener->NumChanges, 0);
+
+			TestWorld.Tick(1.f / 60.f);
+			ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+			TestEqual(TEXT("Number of changes after next frame"), Listener->NumChanges, UGSCTestAttributeSet::NumAttributes);
+		});
+
+		It("should bind attributes right away for a listener bound after registration when asked to", [this]()
+		{
+			CreateWorld(EGSCAttributeSubscription::WhenListened);
+			BindListener();
+			TestWorld.CoreComponent->BindAttributeChangeDelegatesIfListened();
+
+			const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCInstantEffect"), TestWorld.Attributes, 1.f);
+			TestWorld.AbilitySystemComponent->ApplyGameplayEffectToSelf(Effect, 1.f, TestWorld.AbilitySystemComponent->MakeEffectContext());
+
+			TestEqual(TEXT("Number of changes"), Listener->NumChanges, UGSCTestAttributeSet::NumAttributes);
+		});
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for periodic effects on 40 attributes", [this]()
+		{
+			CreateWorld(EGSCAttributeSubscription::AllAttributes);
+			BindListener();
+			const double AllAttributesMs = RunPeriodicEffects();
+			TestWorld.Destroy();
+
+			TArray<FGameplayAttribute> AllAttributes;
+			UGSCBlueprintFunctionLibrary::GetAllAttributes(UGSCTestAttributeSet::StaticClass(), AllAttributes);
+
+			CreateWorld(EGSCAttributeSubscription::SubscribedAttributes, { AllAttributes[0] });
+			BindListener();
+			const double SubscribedMs = RunPeriodicEffects();
+			TestWorld.Destroy();
+
+			CreateWorld(EGSCAttributeSubscription::WhenListened);
+			const double WhenListenedMs = RunPeriodicEffects();
+
+			AddInfo(FString::Printf(TEXT("%d periodic effects x %d attributes: AllAttributes %.2f ms, SubscribedAttributes (1) %.2f ms, WhenListened (no listener) %.2f ms"),
+				NumPeriodicEffects, UGSCTestAttributeSet::NumAttributes, AllAttributesMs, SubscribedMs, WhenListenedMs));
+		});
+	});
+}
@@ -0,0 +1,216 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "EngineUtils.h"
+#include "GSCTestTypes.h"
+#include "Animations/GSCComboWindowNotifyState.h"
+#include "Containers/Ticker.h"
+#include "Editor.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationEditorCommon.h"
+
+BEGIN_DEFINE_SPEC(FGSCComboPredictionSpec, "GASCompanion.Runtime.GSCComboManagerComponent.Prediction", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Emulated one way latency, applied to both server and client net drivers */
+	static constexpr int32 PktLag = 150;
+
+	static constexpr int32 NumInputs = 3;
+
+	/** Delay between two combo inputs, well below the round trip time */
+	static constexpr double InputInterval = 0.05;
+
+	static constexpr double SettleTimeout = 5.0;
+
+	enum class EStep : uint8
+	{
+		WaitForPlayers,
+		PressInputs,
+		WaitForServer,
+		Settle,
+		WaitForEndPlay,
+	};
+
+	EStep Step = EStep::WaitForPlayers;
+	double StepStartTime = 0.0;
+	double LastInputTime = 0.0;
+	int32 NumPressed = 0;
+
+	TWeakObjectPtr<AGSCTestComboCharacter> ServerCharacter;
+	TWeakObjectPtr<AGSCTestComboCharacter> ClientCharacter;
+
+	static void StartPlaySession()
+	{
+		UWorld* EditorWorld = FAutomationEditorCommonUtils::CreateNewMap();
+		EditorWorld->GetWorldSettings()->DefaultGameMode = AGSCTestComboGameMode::StaticClass();
+		EditorWorld->SpawnActor<APlayerStart>();
+
+		ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+		PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_Client);
+		PlaySettings->SetPlayNumberOfClients(1);
+		PlaySettings->SetRunUnderOneProcess(true);
+
+		FRequestPlaySessionParams Params;
+		Params.WorldType = EPlaySessionWorldType::PlayInEditor;
+		Params.EditorPlaySettings = PlaySettings;
+		GEditor->RequestPlaySession(Params);
+	}
+
+	/** Finds the combo character of the dedicated server and the client PIE worlds, once the client has been granted the combo ability */
+	bool FindCharacters()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType != EWorldType::PIE || !World)
+			{
+				continue;
+			}
+
+			for (TActorIterator<AGSCTestComboCharacter> It(World); It; ++It)
+			{
+				if (World->GetNetMode() == NM_DedicatedServer)
+				{
+					ServerCharacter = *It;
+				}
+				else if (World->GetNetMode() == NM_Client && It->IsLocallyControlled())
+				{
+					ClientCharacter = *It;
+				}
+			}
+		}
+
+		return ServerCharacter.IsValid()
+			&& ClientCharacter.IsValid()
+			&& ClientCharacter->ComboManagerComponent->OwnerCoreComponent
+			&& ClientCharacter->AbilitySystemComponent->FindAbilitySpecFromClass(UGSCTestComboAbility::StaticClass());
+	}
+
+	static void SetPacketLag(const UWorld* World)
+	{
+#if DO_ENABLE_NET_TEST
+		if (UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+		{
+			FPacketSimulationSettings Settings = NetDriver->PacketSimulationSettings;
+			Settings.PktLag = PktLag;
+			NetDriver->SetPacketSimulationSettings(Settings);
+		}
+#endif
+	}
+
+	bool TickTest(const FDoneDelegate& Done)
+	{
+		const double Now = FPlatformTime::Seconds();
+
+		switch (Step)
+		{
+		case EStep::WaitForPlayers:
+			if (FindCharacters())
+			{
+				SetPacketLag(ServerCharacter->GetWorld());
+				SetPacketLag(ClientCharacter->GetWorld());
+
+				// Test ability doesn't play montages, open the combo window on both ends as a combo montage notify would
+				UGSCComboWindowNotifyState* ComboWindow = NewObject<UGSCComboWindowNotifyState>();
+				ComboWindow->NotifyBegin(ClientCharacter->GetMesh(), nullptr, 1.f);
+				ComboWindow->NotifyBegin(ServerCharacter->GetMesh(), nullptr, 1.f);
+				TestTrue(TEXT("Client combo window opened"), ClientCharacter->ComboManagerComponent->bComboWindowOpened);
+				TestTrue(TEXT("Server combo window opened"), ServerCharacter->ComboManagerComponent->bComboWindowOpened);
+
+				UGSCTestComboAbility::NumAuthorityActivations = 0;
+				Step = EStep::PressInputs;
+			}
+			else if (Now - StepStartTime > SettleTimeout * 2.0)
+			{
+				AddError(TEXT("Timed out waiting for the client and server characters"));
+				EndPlaySession();
+			}
+			break;
+
+		case EStep::PressInputs:
+			if (Now - LastInputTime >= InputInterval)
+			{
+				UGSCComboManagerComponent* ComboManagerComponent = ClientCharacter->ComboManagerComponent;
+				ComboManagerComponent->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+
+				++NumPressed;
+				LastInputTime = Now;
+
+				// No round trip: the owning client is expected to advance right away
+				TestEqual(FString::Printf(TEXT("Client combo index right after input %d"), NumPressed), ComboManagerComponent->ComboIndex, NumPressed);
+
+				if (NumPressed == NumInputs)
+				{
+					Step = EStep::WaitForServer;
+					StepStartTime = Now;
+				}
+			}
+			break;
+
+		case EStep::WaitForServer:
+			if (ServerCharacter->ComboManagerComponent->ComboIndex == NumInputs || Now - StepStartTime > SettleTimeout)
+			{
+				Step = EStep::Settle;
+				StepStartTime = Now;
+			}
+			break;
+
+		case EStep::Settle:
+			// Leave time for late rejections or corrections to come back
+			if (Now - StepStartTime > PktLag * 4 / 1000.0)
+			{
+				TestEqual(TEXT("Server activations"), UGSCTestComboAbility::NumAuthorityActivations, NumInputs);
+				TestEqual(TEXT("Server combo index"), ServerCharacter->ComboManagerComponent->ComboIndex, NumInputs);
+				TestEqual(TEXT("Client combo index"), ClientCharacter->ComboManagerComponent->ComboIndex, NumInputs);
+				EndPlaySession();
+			}
+			break;
+
+		case EStep::WaitForEndPlay:
+			if (!GEditor->PlayWorld)
+			{
+				Done.Execute();
+				return false;
+			}
+			break;
+		}
+
+		return true;
+	}
+
+	void EndPlaySession()
+	{
+		GEditor->RequestEndPlayMap();
+		Step = EStep::WaitForEndPlay;
+	}
+
+END_DEFINE_SPEC(FGSCComboPredictionSpec)
+
+void FGSCComboPredictionSpec::Define()
+{
+	Describe("PktLag", [this]()
+	{
+		LatentIt("should not drop combo inputs with 150 ms of emulated latency", FTimespan::FromSeconds(60), [this](const FDoneDelegate& Done)
+		{
+#if !DO_ENABLE_NET_TEST
+			AddWarning(TEXT("Packet simulation is disabled in this build, running without emulated latency"));
+#endif
+
+			Step = EStep::WaitForPlayers;
+			StepStartTime = FPlatformTime::Seconds();
+			LastInputTime = 0.0;
+			NumPressed = 0;
+			ServerCharacter.Reset();
+			ClientCharacter.Reset();
+
+			StartPlaySession();
+
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Done](float)
+			{
+				return TickTest(Done);
+			}));
+		});
+	});
+}
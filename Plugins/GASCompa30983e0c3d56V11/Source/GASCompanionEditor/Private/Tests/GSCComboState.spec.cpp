@@ -0,0 +1,177 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+BEGIN_DEFINE_SPEC(FGSCComboStateSpec, "GASCompanion.Runtime.GSCComboManagerComponent.ComboState", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumCharacters = 64;
+	static constexpr double NetUpdateFrequency = 30.0;
+	static constexpr double Duration = 10.0;
+
+	/** Estimated size of a replicated property handle, same for both layouts */
+	static constexpr int32 PropertyHandleBits = 8;
+
+	/** A 3 hits combo, each hit lasting HitDuration, followed by an idle hit */
+	static constexpr int32 NumHits = 3;
+	static constexpr double HitDuration = 0.6;
+
+	/** Combo state of a character chaining combos, following what combo window and trigger notifies would do */
+	static FGSCComboState GetFightingComboState(const double Time)
+	{
+		const double CycleTime = FMath::Fmod(Time, HitDuration * (NumHits + 1));
+		const int32 Hit = static_cast<int32>(CycleTime / HitDuration);
+
+		FGSCComboState State;
+		if (Hit >= NumHits)
+		{
+			return State;
+		}
+
+		const double HitTime = CycleTime - Hit * HitDuration;
+		State.ComboIndex = Hit;
+		State.bComboWindowOpened = HitTime >= 0.2 && HitTime < 0.5;
+		State.bShouldTriggerCombo = State.bComboWindowOpened && HitTime >= 0.3 && Hit < NumHits - 1;
+		State.bRequestTriggerCombo = State.bComboWindowOpened && HitTime >= 0.35;
+		State.bNextComboAbilityActivated = State.bShouldTriggerCombo && State.bRequestTriggerCombo && HitTime >= 0.4;
+		return State;
+	}
+
+	/** Bits sent for a change with the previous layout: one int32 and four bool properties, each changed one with its own handle */
+	static int64 GetUnpackedChangeBits(const FGSCComboState& Previous, const FGSCComboState& Current)
+	{
+		int64 Bits = 0;
+		Bits += Previous.ComboIndex != Current.ComboIndex ? PropertyHandleBits + 32 : 0;
+		Bits += Previous.bComboWindowOpened != Current.bComboWindowOpened ? PropertyHandleBits + 1 : 0;
+		Bits += Previous.bShouldTriggerCombo != Current.bShouldTriggerCombo ? PropertyHandleBits + 1 : 0;
+		Bits += Previous.bRequestTriggerCombo != Current.bRequestTriggerCombo ? PropertyHandleBits + 1 : 0;
+		Bits += Previous.bNextComboAbilityActivated != Current.bNextComboAbilityActivated ? PropertyHandleBits + 1 : 0;
+		return Bits;
+	}
+
+	static int64 GetPackedBits(FGSCComboState State)
+	{
+		FBitWriter Writer(64, true);
+		bool bSuccess = false;
+		State.NetSerialize(Writer, nullptr, bSuccess);
+		return Writer.GetNumBits();
+	}
+
+	static FGSCComboState RoundTrip(FGSCComboState State)
+	{
+		FBitWriter Writer(64, true);
+		bool bSuccess = false;
+		State.NetSerialize(Writer, nullptr, bSuccess);
+
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		FGSCComboState Result;
+		Result.NetSerialize(Reader, nullptr, bSuccess);
+		return Result;
+	}
+
+END_DEFINE_SPEC(FGSCComboStateSpec)
+
+void FGSCComboStateSpec::Define()
+{
+	Describe("NetSerialize", [this]()
+	{
+		It("should round trip combo index and flags in 11 bits", [this]()
+		{
+			FGSCComboState State;
+			State.ComboIndex = 5;
+			State.bComboWindowOpened = true;
+			State.bRequestTriggerCombo = true;
+
+			TestEqual(TEXT("Serialized bits"), GetPackedBits(State), static_cast<int64>(FGSCComboState::ComboIndexBits + FGSCComboState::NumFlags));
+			TestTrue(TEXT("Round trip"), RoundTrip(State) == State);
+
+			State.bComboWindowOpened = false;
+			State.bShouldTriggerCombo = true;
+			State.bNextComboAbilityActivated = true;
+			TestTrue(TEXT("Round trip with other flags"), RoundTrip(State) == State);
+		});
+
+		It("should clamp the combo index to MaxComboIndex", [this]()
+		{
+			FGSCComboState State;
+			State.ComboIndex = 1000;
+			TestEqual(TEXT("Quantized combo index"), RoundTrip(State).ComboIndex, FGSCComboState::MaxComboIndex);
+
+			State.ComboIndex = -1;
+			TestEqual(TEXT("Negative combo index"), RoundTrip(State).ComboIndex, 0);
+		});
+	});
+
+	Describe("Replication", [this]()
+	{
+		It("should replicate the combo state push based, owner only and notified on change", [this]()
+		{
+			TArray<FLifetimeProperty> LifetimeProps;
+			GetDefault<UGSCComboManagerComponent>()->GetLifetimeReplicatedProps(LifetimeProps);
+
+			// Super adds UActorComponent replicated properties, only check the combo state entry
+			const FProperty* ComboStateProperty = FindFProperty<FProperty>(UGSCComboManagerComponent::StaticClass(), TEXT("ReplicatedComboState"));
+			if (!TestNotNull(TEXT("ReplicatedComboState property"), ComboStateProperty))
+			{
+				return;
+			}
+
+			const FLifetimeProperty* ComboStateProp = LifetimeProps.FindByPredicate([ComboStateProperty](const FLifetimeProperty& Prop)
+			{
+				return Prop.RepIndex == ComboStateProperty->RepIndex;
+			});
+
+			if (TestNotNull(TEXT("Replicated combo state"), ComboStateProp))
+			{
+				TestTrue(TEXT("Owner only"), ComboStateProp->Condition == COND_OwnerOnly);
+				TestTrue(TEXT("Notified on change"), ComboStateProp->RepNotifyCondition == REPNOTIFY_OnChanged);
+				TestTrue(TEXT("Push based"), ComboStateProp->bIsPushBased);
+			}
+		});
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report replicated bytes per second for 64 fighting characters", [this]()
+		{
+			const int32 NumUpdates = static_cast<int32>(Duration * NetUpdateFrequency);
+
+			int64 NumChanges = 0;
+			int64 UnpackedBits = 0;
+			int64 PackedBits = 0;
+			for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+			{
+				// Characters don't fight in sync
+				const double Offset = CharacterIndex * 0.137;
+
+				FGSCComboState Previous;
+				for (int32 Update = 1; Update <= NumUpdates; ++Update)
+				{
+					const FGSCComboState Current = GetFightingComboState(Offset + Update / NetUpdateFrequency);
+					if (Current == Previous)
+					{
+						continue;
+					}
+
+					++NumChanges;
+					UnpackedBits += GetUnpackedChangeBits(Previous, Current);
+					PackedBits += PropertyHandleBits + GetPackedBits(Current);
+					Previous = Current;
+				}
+			}
+
+			TestTrue(TEXT("Combo state changed"), NumChanges > 0);
+
+			// Previous layout replicated to every connection (one per character), combo state only goes to the owner
+			const double UnpackedBytesPerSecond = UnpackedBits / 8.0 / Duration;
+			const double PackedBytesPerSecond = PackedBits / 8.0 / Duration;
+
+			AddInfo(FString::Printf(TEXT("%d characters, %lld combo state changes in %.0f s: previous layout %.1f B/s per connection (%.1f B/s to %d connections), packed %.1f B/s (owner only)"),
+				NumCharacters, NumChanges, Duration, UnpackedBytesPerSecond, UnpackedBytesPerSecond * NumCharacters, NumCharacters, PackedBytesPerSecond));
+		});
+	});
+}
@@ -0,0 +1,185 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Abilities/GSCCooldownTracker.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCCooldownTrackerSpec, "GASCompanion.Runtime.GSCCooldownTracker", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumConcurrentCooldowns = 1000;
+	static constexpr double SlotDuration = 1.0 / 30.0;
+	static constexpr double FrameDuration = 1.0 / 60.0;
+
+	static FGameplayAbilitySpecHandle MakeHandle()
+	{
+		FGameplayAbilitySpecHandle Handle;
+		Handle.GenerateNewHandle();
+		return Handle;
+	}
+
+	/** Expired handles, in expiration order, along with the time they were reported at */
+	TArray<TPair<FGameplayAbilitySpecHandle, double>> Expired;
+
+	void Advance(FGSCCooldownTracker& Tracker, const double Now)
+	{
+		Tracker.Advance(Now, [this, Now](const FGameplayAbilitySpecHandle& AbilitySpecHandle, const FGameplayTagContainer&, float)
+		{
+			Expired.Emplace(AbilitySpecHandle, Now);
+		});
+	}
+
+	/** Advances frame by frame from Start to End, returns the time spent in Advance in milliseconds */
+	double AdvanceFrames(FGSCCooldownTracker& Tracker, const double Start, const double End)
+	{
+		double ElapsedSeconds = 0.0;
+		for (double Now = Start; Now <= End; Now += FrameDuration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Advance(Tracker, Now);
+			ElapsedSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		return ElapsedSeconds * 1000.0;
+	}
+
+END_DEFINE_SPEC(FGSCCooldownTrackerSpec)
+
+void FGSCCooldownTrackerSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Expired.Reset();
+	});
+
+	It("should report remaining time and fraction", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+		const FGameplayAbilitySpecHandle Handle = MakeHandle();
+
+		Tracker.Start(Handle, FGameplayTagContainer(), 10.0, 4.f, 4.f);
+
+		TestTrue(TEXT("Is tracking"), Tracker.IsTracking(Handle));
+		TestEqual(TEXT("Time remaining"), Tracker.GetTimeRemaining(Handle, 11.0), 3.f);
+		TestEqual(TEXT("Remaining fraction"), Tracker.GetRemainingFraction(Handle, 11.0), 0.75f);
+		TestEqual(TEXT("Time remaining of untracked handle"), Tracker.GetTimeRemaining(MakeHandle(), 11.0), 0.f);
+	});
+
+	It("should never expire early, and at most one slot late", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+		const FGameplayAbilitySpecHandle Handle = MakeHandle();
+
+		Tracker.Start(Handle, FGameplayTagContainer(), 0.0, 1.f, 1.f);
+
+		Advance(Tracker, 0.99);
+		TestEqual(TEXT("Expired before end"), Expired.Num(), 0);
+
+		Advance(Tracker, 1.0 + SlotDuration);
+		TestEqual(TEXT("Expired after end"), Expired.Num(), 1);
+		TestFalse(TEXT("Is tracking"), Tracker.IsTracking(Handle));
+	});
+
+	It("should not expire cancelled cooldowns", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+		const FGameplayAbilitySpecHandle Handle = MakeHandle();
+
+		Tracker.Start(Handle, FGameplayTagContainer(), 0.0, 1.f, 1.f);
+		TestTrue(TEXT("Cancelled"), Tracker.Cancel(Handle));
+
+		Advance(Tracker, 2.0);
+		TestEqual(TEXT("Expired"), Expired.Num(), 0);
+		TestEqual(TEXT("Num"), Tracker.Num(), 0);
+	});
+
+	It("should reschedule restarted cooldowns", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+		const FGameplayAbilitySpecHandle Handle = MakeHandle();
+
+		Tracker.Start(Handle, FGameplayTagContainer(), 0.0, 1.f, 1.f);
+		Tracker.Start(Handle, FGameplayTagContainer(), 0.5, 2.f, 2.f);
+
+		Advance(Tracker, 1.5);
+		TestEqual(TEXT("Expired at first end"), Expired.Num(), 0);
+
+		Advance(Tracker, 2.6);
+		TestEqual(TEXT("Expired at second end"), Expired.Num(), 1);
+	});
+
+	It("should cascade cooldowns longer than the wheel levels", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+
+		// Level 0 spans ~8.5s, level 1 ~9min with 1/30s slots
+		const TArray<float> Durations = { 0.5f, 30.f, 1200.f };
+		TArray<FGameplayAbilitySpecHandle> Handles;
+		for (const float Duration : Durations)
+		{
+			Handles.Add(MakeHandle());
+			Tracker.Start(Handles.Last(), FGameplayTagContainer(), 0.0, Duration, Duration);
+		}
+
+		AdvanceFrames(Tracker, 0.0, 1201.0);
+
+		TestEqual(TEXT("Expired"), Expired.Num(), Durations.Num());
+		for (int32 Index = 0; Index < Expired.Num(); ++Index)
+		{
+			TestTrue(FString::Printf(TEXT("Expiration order %d"), Index), Expired[Index].Key == Handles[Index]);
+			TestTrue(FString::Printf(TEXT("Not early %d"), Index), Expired[Index].Value >= Durations[Index]);
+			TestTrue(FString::Printf(TEXT("Not late %d"), Index), Expired[Index].Value <= Durations[Index] + SlotDuration + FrameDuration);
+		}
+	});
+
+	It("should report timings for 1k concurrent cooldowns", [this]()
+	{
+		FGSCCooldownTracker Tracker(SlotDuration);
+		FRandomStream RandomStream(1337);
+
+		TArray<FGameplayAbilitySpecHandle> Handles;
+		TArray<float> Durations;
+		for (int32 Index = 0; Index < NumConcurrentCooldowns; ++Index)
+		{
+			Handles.Add(MakeHandle());
+			Durations.Add(RandomStream.FRandRange(0.1f, 20.f));
+		}
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumConcurrentCooldowns; ++Index)
+		{
+			Tracker.Start(Handles[Index], FGameplayTagContainer(), 0.0, Durations[Index], Durations[Index]);
+		}
+		const double StartMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		float TotalRemaining = 0.f;
+		StartTime = FPlatformTime::Seconds();
+		for (const FGameplayAbilitySpecHandle& Handle : Handles)
+		{
+			TotalRemaining += Tracker.GetRemainingFraction(Handle, 0.05);
+		}
+		const double QueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		TestTrue(TEXT("Remaining fractions"), TotalRemaining > 0.f);
+
+		const double AdvanceMs = AdvanceFrames(Tracker, 0.0, 21.0);
+		TestEqual(TEXT("Expired"), Expired.Num(), NumConcurrentCooldowns);
+		TestEqual(TEXT("Num"), Tracker.Num(), 0);
+
+		// Cancel benchmark on a fresh set of cooldowns
+		for (int32 Index = 0; Index < NumConcurrentCooldowns; ++Index)
+		{
+			Tracker.Start(Handles[Index], FGameplayTagContainer(), 30.0, Durations[Index], Durations[Index]);
+		}
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FGameplayAbilitySpecHandle& Handle : Handles)
+		{
+			Tracker.Cancel(Handle);
+		}
+		const double CancelMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("%d concurrent cooldowns: Start %.3f ms, Query %.3f ms, Cancel %.3f ms, Advance over %d frames %.3f ms"),
+			NumConcurrentCooldowns, StartMs, QueryMs, CancelMs, FMath::CeilToInt(21.0 / FrameDuration), AdvanceMs));
+	});
+}
@@ -0,0 +1,94 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCCostCheckSpec, "GASCompanion.Runtime.GSCGameplayAbility.CostCheck", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumChecks = 100000;
+
+	FGSCTestWorld TestWorld;
+
+	const FGameplayAbilityActorInfo* GetActorInfo() const
+	{
+		return TestWorld.AbilitySystemComponent->AbilityActorInfo.Get();
+	}
+
+	void SetAttributeValues(const float Value0, const float Value1, const float Value2) const
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		ASC->SetNumericAttributeBase(TestWorld.Attributes[0], Value0);
+		ASC->SetNumericAttributeBase(TestWorld.Attributes[1], Value1);
+		ASC->SetNumericAttributeBase(TestWorld.Attributes[2], Value2);
+	}
+
+END_DEFINE_SPEC(FGSCCostCheckSpec)
+
+void FGSCCostCheckSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+	});
+
+	It("should match the spec based cost check", [this]()
+	{
+		const UGSCTestCostAbility* Ability = GetDefault<UGSCTestCostAbility>();
+		const float Values[] = { -1.f, 0.f, 5.f };
+
+		for (const float Value0 : Values)
+		{
+			for (const float Value1 : Values)
+			{
+				for (const float Value2 : Values)
+				{
+					SetAttributeValues(Value0, Value1, Value2);
+
+					const bool bExpected = Ability->CheckCostWithSpec(GetActorInfo());
+					TestEqual(FString::Printf(TEXT("Cost check with %.0f, %.0f, %.0f"), Value0, Value1, Value2), Ability->CheckCostWithCompiledAttributes(GetActorInfo()), bExpected);
+				}
+			}
+		}
+
+		// Multiplicative modifiers aren't checked
+		SetAttributeValues(5.f, 5.f, -1.f);
+		TestTrue(TEXT("Cost check with multiplied attribute <= 0"), Ability->CheckCostWithCompiledAttributes(GetActorInfo()));
+
+		SetAttributeValues(5.f, 0.f, 5.f);
+		TestFalse(TEXT("Cost check with added attribute <= 0"), Ability->CheckCostWithCompiledAttributes(GetActorInfo()));
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for 100k cost checks", [this]()
+		{
+			const UGSCTestCostAbility* Ability = GetDefault<UGSCTestCostAbility>();
+			SetAttributeValues(5.f, 5.f, 5.f);
+
+			int32 NumPassed = 0;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumChecks; ++Index)
+			{
+				NumPassed += Ability->CheckCostWithSpec(GetActorInfo()) ? 1 : 0;
+			}
+			const double SpecMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumChecks; ++Index)
+			{
+				NumPassed += Ability->CheckCostWithCompiledAttributes(GetActorInfo()) ? 1 : 0;
+			}
+			const double CompiledMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TestEqual(TEXT("Passed checks"), NumPassed, NumChecks * 2);
+			AddInfo(FString::Printf(TEXT("%d cost checks: spec based %.2f ms, compiled attributes %.2f ms"), NumChecks, SpecMs, CompiledMs));
+		});
+	});
+}
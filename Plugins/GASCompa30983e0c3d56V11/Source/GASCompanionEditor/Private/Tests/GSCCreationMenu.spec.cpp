@@ -1,5 +1,6 @@
 ﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
 
+#include "GSCTestTypes.h"
 #include "FileHelpers.h"
 #include "ObjectTools.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -7,14 +8,6 @@
 #include "CreationMenu/GSCGameplayEffectCreationMenu.h"
 #include "HAL/FileManager.h"
 #include "Misc/AutomationTest.h"
-#include "Misc/EngineVersionComparison.h"
-
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
-
-// 5.4.x and down
-inline constexpr uint8 EAutomationTestFlags_ApplicationContextMask = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext;
-
-#endif
 
 BEGIN_DEFINE_SPEC(FGSCCreationMenuSpec, "GASCompanion.Editor.GSCCreationMenu", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
 
@@ -0,0 +1,118 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCDamageExecutionSpec, "GASCompanion.Runtime.GSCAttributeSet.DamageExecution", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumExecutions = 10000;
+
+	FGSCTestWorld TestWorld;
+	UGSCTestDamageListener* Listener = nullptr;
+
+	/** Adds a UGSCAttributeSet to the test world ASC, with Health and MaxHealth set to Health */
+	void AddAttributeSet(const float Health) const
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		ASC->AddSpawnedAttribute(NewObject<UGSCAttributeSet>(TestWorld.Actor));
+		ASC->SetNumericAttributeBase(UGSCAttributeSet::GetMaxHealthAttribute(), Health);
+		ASC->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), Health);
+	}
+
+	void ApplyDamage(const UGameplayEffect* Effect, const int32 NumApplications) const
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		for (int32 Index = 0; Index < NumApplications; ++Index)
+		{
+			ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+		}
+	}
+
+END_DEFINE_SPEC(FGSCDamageExecutionSpec)
+
+void FGSCDamageExecutionSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(true);
+		TestWorld.CoreComponent->SetStartupAbilitiesGranted(true);
+
+		Listener = NewObject<UGSCTestDamageListener>(TestWorld.Actor);
+		TestWorld.CoreComponent->OnDamage.AddDynamic(Listener, &UGSCTestDamageListener::OnDamage);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Listener = nullptr;
+	});
+
+	It("should handle damage with an attribute set added after the core component registered", [this]()
+	{
+		AddAttributeSet(100.f);
+
+		const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCDamageEffect"), { UGSCAttributeSet::GetDamageAttribute() }, 10.f);
+		ApplyDamage(Effect, 3);
+
+		TestEqual(TEXT("Health"), TestWorld.AbilitySystemComponent->GetNumericAttribute(UGSCAttributeSet::GetHealthAttribute()), 70.f);
+		TestEqual(TEXT("Number of damages"), Listener->NumDamages, 3);
+		TestEqual(TEXT("Damage amount"), Listener->LastDamageAmount, 10.f);
+		TestTrue(TEXT("Source actor"), Listener->LastSourceActor.Get() == TestWorld.Actor);
+	});
+
+	It("should handle damage with the core component set by registration, and forward executions to bound listeners only", [this]()
+	{
+		AddAttributeSet(100.f);
+		TestWorld.CoreComponent->RegisterAbilitySystemDelegates(TestWorld.AbilitySystemComponent);
+
+		const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCDamageEffect"), { UGSCAttributeSet::GetDamageAttribute() }, 10.f);
+		ApplyDamage(Effect, 1);
+		TestEqual(TEXT("Number of executions without listener"), Listener->NumExecutions, 0);
+
+		TestWorld.CoreComponent->OnPostGameplayEffectExecute.AddDynamic(Listener, &UGSCTestDamageListener::OnPostGameplayEffectExecute);
+		ApplyDamage(Effect, 1);
+
+		TestEqual(TEXT("Health"), TestWorld.AbilitySystemComponent->GetNumericAttribute(UGSCAttributeSet::GetHealthAttribute()), 80.f);
+		TestEqual(TEXT("Number of damages"), Listener->NumDamages, 2);
+		TestEqual(TEXT("Number of executions"), Listener->NumExecutions, 1);
+	});
+
+	It("should stop forwarding events once the core component shuts down its delegates", [this]()
+	{
+		AddAttributeSet(100.f);
+		TestWorld.CoreComponent->RegisterAbilitySystemDelegates(TestWorld.AbilitySystemComponent);
+		TestWorld.CoreComponent->ShutdownAbilitySystemDelegates(TestWorld.AbilitySystemComponent);
+		TestWorld.CoreComponent->DestroyComponent();
+
+		const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCDamageEffect"), { UGSCAttributeSet::GetDamageAttribute() }, 10.f);
+		ApplyDamage(Effect, 1);
+
+		TestEqual(TEXT("Health"), TestWorld.AbilitySystemComponent->GetNumericAttribute(UGSCAttributeSet::GetHealthAttribute()), 90.f);
+		TestEqual(TEXT("Number of damages"), Listener->NumDamages, 0);
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for 10k damage executions", [this]()
+		{
+			AddAttributeSet(NumExecutions * 10.f);
+			TestWorld.CoreComponent->RegisterAbilitySystemDelegates(TestWorld.AbilitySystemComponent);
+
+			const UGameplayEffect* Effect = FGSCTestWorld::MakeEffect(TEXT("GSCDamageEffect"), { UGSCAttributeSet::GetDamageAttribute() }, 1.f);
+
+			double StartTime = FPlatformTime::Seconds();
+			ApplyDamage(Effect, NumExecutions);
+			const double UnboundMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TestWorld.CoreComponent->OnPostGameplayEffectExecute.AddDynamic(Listener, &UGSCTestDamageListener::OnPostGameplayEffectExecute);
+
+			StartTime = FPlatformTime::Seconds();
+			ApplyDamage(Effect, NumExecutions);
+			const double BoundMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TestEqual(TEXT("Number of damages"), Listener->NumDamages, NumExecutions * 2);
+			AddInfo(FString::Printf(TEXT("%d damage executions: %.2f ms without OnPostGameplayEffectExecute listener, %.2f ms with one"), NumExecutions, UnboundMs, BoundMs));
+		});
+	});
+}
@@ -0,0 +1,169 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCEffectContainerApplicationSpec, "GASCompanion.Runtime.GSCGameplayAbility.EffectContainerApplication", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** Number of effect applications per benchmark run, whatever the number of targets */
+	static constexpr int32 NumApplications = 100000;
+
+	FGSCTestWorld TestWorld;
+	UGSCTestEffectContainerAbility* Ability = nullptr;
+
+	/** Gives and activates a UGSCTestEffectContainerAbility on the test world actor */
+	UGSCTestEffectContainerAbility* ActivateAbility() const
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		const FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestEffectContainerAbility::StaticClass()));
+		ASC->TryActivateAbility(Handle);
+
+		const FGameplayAbilitySpec* AbilitySpec = ASC->FindAbilitySpecFromHandle(Handle);
+		return AbilitySpec ? Cast<UGSCTestEffectContainerAbility>(AbilitySpec->GetPrimaryInstance()) : nullptr;
+	}
+
+	/** Spawns actors with an ASC and a UGSCTestAttributeSet, returning them as a single actor array target data */
+	FGameplayAbilityTargetDataHandle SpawnTargets(const int32 NumTargets, TArray<UAbilitySystemComponent*>& OutTargetASCs) const
+	{
+		FGameplayAbilityTargetData_ActorArray* TargetData = new FGameplayAbilityTargetData_ActorArray();
+		for (int32 Index = 0; Index < NumTargets; ++Index)
+		{
+			AActor* Actor = TestWorld.World->SpawnActor<AActor>();
+
+			UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Actor, TEXT("AbilitySystemComponent"));
+			ASC->RegisterComponent();
+			ASC->AddSpawnedAttribute(NewObject<UGSCTestAttributeSet>(Actor));
+			ASC->InitAbilityActorInfo(Actor, Actor);
+
+			TargetData->TargetActorArray.Add(Actor);
+			OutTargetASCs.Add(ASC);
+		}
+
+		return FGameplayAbilityTargetDataHandle(TargetData);
+	}
+
+	FGSCGameplayEffectContainerSpec MakeContainerSpec(const FGameplayAbilityTargetDataHandle& TargetData) const
+	{
+		FGSCGameplayEffectContainer Container;
+		Container.TargetGameplayEffectClasses = { UGSCTestDamageEffect::StaticClass(), UGSCTestHitEffect::StaticClass() };
+
+		FGSCGameplayEffectContainerSpec ContainerSpec = Ability->MakeEffectContainerSpecFromContainer(Container, FGameplayEventData());
+		ContainerSpec.TargetData.Append(TargetData);
+		return ContainerSpec;
+	}
+
+	static TArray<AActor*> GetTargetActors(const FGSCGameplayEffectContainerSpec& ContainerSpec)
+	{
+		TArray<AActor*> Actors;
+		for (int32 Index = 0; Index < ContainerSpec.TargetData.Num(); ++Index)
+		{
+			for (const TWeakObjectPtr<AActor>& Actor : ContainerSpec.TargetData.Get(Index)->GetActors())
+			{
+				Actors.Add(Actor.Get());
+			}
+		}
+
+		return Actors;
+	}
+
+	/** Applies a container spec to NumTargets targets until NumApplications effects are applied, returning the time per effect application in microseconds */
+	double RunApplications(const int32 NumTargets, const bool bBatchEffectContainerApplication)
+	{
+		TArray<UAbilitySystemComponent*> TargetASCs;
+		const FGSCGameplayEffectContainerSpec ContainerSpec = MakeContainerSpec(SpawnTargets(NumTargets, TargetASCs));
+		Ability->bBatchEffectContainerApplication = bBatchEffectContainerApplication;
+
+		const int32 NumEffects = ContainerSpec.TargetGameplayEffectSpecs.Num();
+		const int32 NumRuns = FMath::Max(1, NumApplications / (NumTargets * NumEffects));
+
+		int64 NumHandles = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Run = 0; Run < NumRuns; ++Run)
+		{
+			NumHandles += Ability->ApplyEffectContainerSpec(ContainerSpec).Num();
+		}
+		const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(FString::Printf(TEXT("Applied effects to %d targets"), NumTargets), NumHandles, static_cast<int64>(NumRuns) * NumTargets * NumEffects);
+
+		for (AActor* Actor : GetTargetActors(ContainerSpec))
+		{
+			Actor->Destroy();
+		}
+
+		return NumHandles > 0 ? Elapsed * 1000000.0 / NumHandles : 0.0;
+	}
+
+END_DEFINE_SPEC(FGSCEffectContainerApplicationSpec)
+
+void FGSCEffectContainerApplicationSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+		Ability = ActivateAbility();
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Ability = nullptr;
+	});
+
+	It("should apply the same effects as the per target path", [this]()
+	{
+		if (!TestNotNull(TEXT("Ability"), Ability))
+		{
+			return;
+		}
+
+		TArray<UAbilitySystemComponent*> PerTargetASCs;
+		TArray<UAbilitySystemComponent*> BatchedASCs;
+		FGSCGameplayEffectContainerSpec PerTargetSpec = MakeContainerSpec(SpawnTargets(4, PerTargetASCs));
+		FGSCGameplayEffectContainerSpec BatchedSpec = MakeContainerSpec(SpawnTargets(4, BatchedASCs));
+
+		// A second target data, and an actor without ASC which gets skipped
+		PerTargetSpec.TargetData.Append(SpawnTargets(2, PerTargetASCs));
+		BatchedSpec.TargetData.Append(SpawnTargets(2, BatchedASCs));
+		PerTargetSpec.AddTargets(TArray<FHitResult>(), { TestWorld.World->SpawnActor<AActor>() });
+		BatchedSpec.AddTargets(TArray<FHitResult>(), { TestWorld.World->SpawnActor<AActor>() });
+
+		Ability->bBatchEffectContainerApplication = false;
+		const TArray<FActiveGameplayEffectHandle> PerTargetHandles = Ability->ApplyEffectContainerSpec(PerTargetSpec);
+
+		Ability->bBatchEffectContainerApplication = true;
+		const TArray<FActiveGameplayEffectHandle> BatchedHandles = Ability->ApplyEffectContainerSpec(BatchedSpec);
+
+		TestEqual(TEXT("Number of handles"), BatchedHandles.Num(), PerTargetHandles.Num());
+		TestEqual(TEXT("Number of batched handles"), BatchedHandles.Num(), 12);
+
+		const FGameplayAttribute& DamageAttribute = TestWorld.Attributes[0];
+		const FGameplayAttribute& HitAttribute = TestWorld.Attributes[10];
+		for (int32 Index = 0; Index < BatchedASCs.Num(); ++Index)
+		{
+			TestEqual(TEXT("Damage attribute"), BatchedASCs[Index]->GetNumericAttribute(DamageAttribute), PerTargetASCs[Index]->GetNumericAttribute(DamageAttribute));
+			TestEqual(TEXT("Hit attribute"), BatchedASCs[Index]->GetNumericAttribute(HitAttribute), 1.f);
+		}
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for the per target and batched paths at 10, 100 and 1000 targets", [this]()
+		{
+			if (!TestNotNull(TEXT("Ability"), Ability))
+			{
+				return;
+			}
+
+			for (const int32 NumTargets : { 10, 100, 1000 })
+			{
+				const double PerTargetUs = RunApplications(NumTargets, false);
+				const double BatchedUs = RunApplications(NumTargets, true);
+
+				AddInfo(FString::Printf(TEXT("%d targets, 2 effects: per target %.3f us per application, batched %.3f us per application"), NumTargets, PerTargetUs, BatchedUs));
+			}
+		});
+	});
+}
@@ -0,0 +1,221 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "NativeGameplayTags.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Hit_1, "GSCTest.Hit.1");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Hit_2, "GSCTest.Hit.2");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Hit_3, "GSCTest.Hit.3");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Hit_4, "GSCTest.Hit.4");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Hit_5, "GSCTest.Hit.5");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_SetByCaller, "GSCTest.SetByCaller");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Stance, "GSCTest.Stance");
+
+BEGIN_DEFINE_SPEC(FGSCEffectContainerSpecCacheSpec, "GASCompanion.Runtime.GSCGameplayAbility.EffectContainerSpecCache", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumAttackers = 100;
+	static constexpr int32 NumCombos = 20;
+
+	FGSCTestWorld TestWorld;
+
+	static TArray<FGameplayTag> GetHitTags()
+	{
+		return { TAG_GSCTest_Hit_1, TAG_GSCTest_Hit_2, TAG_GSCTest_Hit_3, TAG_GSCTest_Hit_4, TAG_GSCTest_Hit_5 };
+	}
+
+	/** Spawns an actor with an ASC and an active UGSCTestEffectContainerAbility, with one effect container per combo hit */
+	UGSCTestEffectContainerAbility* SpawnAttacker(const bool bCacheEffectContainerSpecs) const
+	{
+		AActor* Actor = TestWorld.World->SpawnActor<AActor>();
+
+		UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Actor, TEXT("AbilitySystemComponent"));
+		ASC->RegisterComponent();
+		ASC->AddSpawnedAttribute(NewObject<UGSCTestAttributeSet>(Actor));
+		ASC->InitAbilityActorInfo(Actor, Actor);
+
+		const FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(FGameplayAbilitySpec(UGSCTestEffectContainerAbility::StaticClass()));
+		ASC->TryActivateAbility(Handle);
+
+		const FGameplayAbilitySpec* AbilitySpec = ASC->FindAbilitySpecFromHandle(Handle);
+		UGSCTestEffectContainerAbility* Ability = AbilitySpec ? Cast<UGSCTestEffectContainerAbility>(AbilitySpec->GetPrimaryInstance()) : nullptr;
+		if (!Ability)
+		{
+			return nullptr;
+		}
+
+		Ability->bCacheEffectContainerSpecs = bCacheEffectContainerSpecs;
+
+		const TArray<FGameplayTag> HitTags = GetHitTags();
+		for (int32 Hit = 0; Hit < HitTags.Num(); ++Hit)
+		{
+			FGSCGameplayEffectContainer& Container = Ability->EffectContainerMap.Add(HitTags[Hit]);
+			Container.TargetGameplayEffectClasses = { UGSCTestDamageEffect::StaticClass(), UGSCTestHitEffect::StaticClass() };
+			Container.bUseSetByCallerMagnitude = true;
+			Container.SetByCallerDataTag = TAG_GSCTest_SetByCaller;
+			Container.SetByCallerMagnitude = Hit + 1.f;
+		}
+
+		return Ability;
+	}
+
+	/** Makes container specs for NumCombos 5 hits combos of NumAttackers attackers, returning the number of effect specs made per second */
+	double RunCombos(const bool bCacheEffectContainerSpecs) const
+	{
+		TArray<UGSCTestEffectContainerAbility*> Attackers;
+		for (int32 Index = 0; Index < NumAttackers; ++Index)
+		{
+			Attackers.Add(SpawnAttacker(bCacheEffectContainerSpecs));
+		}
+
+		const TArray<FGameplayTag> HitTags = GetHitTags();
+		const FGameplayEventData EventData;
+		int64 NumSpecs = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Combo = 0; Combo < NumCombos; ++Combo)
+		{
+			for (const FGameplayTag& HitTag : HitTags)
+			{
+				for (UGSCTestEffectContainerAbility* Attacker : Attackers)
+				{
+					NumSpecs += Attacker->MakeEffectContainerSpec(HitTag, EventData).TargetGameplayEffectSpecs.Num();
+				}
+			}
+		}
+
+		const double Elapsed = FPlatformTime::Seconds() - StartTime;
+		return Elapsed > 0.0 ? NumSpecs / Elapsed : 0.0;
+	}
+
+END_DEFINE_SPEC(FGSCEffectContainerSpecCacheSpec)
+
+void FGSCEffectContainerSpecCacheSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+	});
+
+	It("should cache one spec per effect class and level, and hand out copies", [this]()
+	{
+		UGSCTestEffectContainerAbility* Ability = SpawnAttacker(true);
+		if (!TestNotNull(TEXT("Ability"), Ability))
+		{
+			return;
+		}
+
+		const FGSCGameplayEffectContainerSpec First = Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_1, FGameplayEventData());
+		const FGSCGameplayEffectContainerSpec Second = Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_1, FGameplayEventData());
+		TestEqual(TEXT("Cached specs"), Ability->GetNumCachedEffectContainerSpecs(), 2);
+
+		if (!TestEqual(TEXT("Number of specs"), Second.TargetGameplayEffectSpecs.Num(), 2))
+		{
+			return;
+		}
+
+		TestTrue(TEXT("Specs are copies"), First.TargetGameplayEffectSpecs[0].Data.Get() != Second.TargetGameplayEffectSpecs[0].Data.Get());
+
+		// Other containers with the same effects reuse the cached specs, with their own SetByCaller magnitude
+		const FGSCGameplayEffectContainerSpec Third = Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_3, FGameplayEventData());
+		TestEqual(TEXT("Cached specs after another container"), Ability->GetNumCachedEffectContainerSpecs(), 2);
+		TestEqual(TEXT("SetByCaller magnitude"), Third.TargetGameplayEffectSpecs[0].Data->GetSetByCallerMagnitude(TAG_GSCTest_SetByCaller, false), 3.f);
+		TestEqual(TEXT("SetByCaller magnitude of the first spec"), First.TargetGameplayEffectSpecs[0].Data->GetSetByCallerMagnitude(TAG_GSCTest_SetByCaller, false), 1.f);
+
+		const FGSCGameplayEffectContainerSpec Leveled = Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_1, FGameplayEventData(), 2);
+		TestEqual(TEXT("Cached specs after another level"), Ability->GetNumCachedEffectContainerSpecs(), 4);
+		TestEqual(TEXT("Spec level"), Leveled.TargetGameplayEffectSpecs[0].Data->GetLevel(), 2.f);
+
+		Ability->InvalidateEffectContainerSpecCache();
+		TestEqual(TEXT("Cached specs after invalidation"), Ability->GetNumCachedEffectContainerSpecs(), 0);
+	});
+
+	It("should make the same specs as without cache, with fresh context and source tags", [this]()
+	{
+		UGSCTestEffectContainerAbility* Cached = SpawnAttacker(true);
+		UGSCTestEffectContainerAbility* Uncached = SpawnAttacker(false);
+		if (!TestNotNull(TEXT("Cached ability"), Cached) || !TestNotNull(TEXT("Uncached ability"), Uncached))
+		{
+			return;
+		}
+
+		// Fill the cache before the source gets a new tag
+		Cached->MakeEffectContainerSpec(TAG_GSCTest_Hit_2, FGameplayEventData());
+		Cached->GetAbilitySystemComponentFromActorInfo()->AddLooseGameplayTag(TAG_GSCTest_Stance);
+		Uncached->GetAbilitySystemComponentFromActorInfo()->AddLooseGameplayTag(TAG_GSCTest_Stance);
+
+		const FGSCGameplayEffectContainerSpec CachedSpec = Cached->MakeEffectContainerSpec(TAG_GSCTest_Hit_2, FGameplayEventData());
+		const FGSCGameplayEffectContainerSpec UncachedSpec = Uncached->MakeEffectContainerSpec(TAG_GSCTest_Hit_2, FGameplayEventData());
+		TestEqual(TEXT("Uncached ability doesn't cache"), Uncached->GetNumCachedEffectContainerSpecs(), 0);
+
+		if (!TestEqual(TEXT("Number of specs"), CachedSpec.TargetGameplayEffectSpecs.Num(), UncachedSpec.TargetGameplayEffectSpecs.Num()))
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < CachedSpec.TargetGameplayEffectSpecs.Num(); ++Index)
+		{
+			const FGameplayEffectSpec* A = CachedSpec.TargetGameplayEffectSpecs[Index].Data.Get();
+			const FGameplayEffectSpec* B = UncachedSpec.TargetGameplayEffectSpecs[Index].Data.Get();
+
+			TestTrue(TEXT("Effect"), A->Def == B->Def);
+			TestEqual(TEXT("Level"), A->GetLevel(), B->GetLevel());
+			TestEqual(TEXT("Number of modifiers"), A->Modifiers.Num(), B->Modifiers.Num());
+			TestEqual(TEXT("SetByCaller magnitude"), A->GetSetByCallerMagnitude(TAG_GSCTest_SetByCaller, false), B->GetSetByCallerMagnitude(TAG_GSCTest_SetByCaller, false));
+			TestTrue(TEXT("Instigator"), A->GetEffectContext().GetInstigator() == Cached->GetAvatarActorFromActorInfo());
+			TestTrue(TEXT("Ability instance"), A->GetEffectContext().GetAbilityInstance_NotReplicated() == Cached);
+			TestTrue(TEXT("Source tags captured again"), A->CapturedSourceTags.GetActorTags().HasTagExact(TAG_GSCTest_Stance));
+		}
+	});
+
+	It("should apply dynamic source tags added to the ability spec after caching", [this]()
+	{
+		UGSCTestEffectContainerAbility* Ability = SpawnAttacker(true);
+		if (!TestNotNull(TEXT("Ability"), Ability))
+		{
+			return;
+		}
+
+		Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_1, FGameplayEventData());
+
+		FGameplayAbilitySpec* AbilitySpec = Ability->GetAbilitySystemComponentFromActorInfo()->FindAbilitySpecFromHandle(Ability->GetCurrentAbilitySpecHandle());
+		if (!TestNotNull(TEXT("Ability spec"), AbilitySpec))
+		{
+			return;
+		}
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+		AbilitySpec->DynamicAbilityTags.AddTag(TAG_GSCTest_Stance);
+#else
+		AbilitySpec->GetDynamicSpecSourceTags().AddTag(TAG_GSCTest_Stance);
+#endif
+
+		const FGSCGameplayEffectContainerSpec Spec = Ability->MakeEffectContainerSpec(TAG_GSCTest_Hit_1, FGameplayEventData());
+		TestEqual(TEXT("Cached specs"), Ability->GetNumCachedEffectContainerSpecs(), 2);
+		for (const FGameplayEffectSpecHandle& SpecHandle : Spec.TargetGameplayEffectSpecs)
+		{
+			TestTrue(TEXT("Dynamic source tag"), SpecHandle.Data->CapturedSourceTags.GetSpecTags().HasTagExact(TAG_GSCTest_Stance));
+		}
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report specs per second for a 5 hits combo across 100 attackers", [this]()
+		{
+			const double UncachedSpecsPerSecond = RunCombos(false);
+			TestWorld.Destroy();
+
+			TestWorld.Create(false);
+			const double CachedSpecsPerSecond = RunCombos(true);
+
+			AddInfo(FString::Printf(TEXT("%d attackers x %d combos of %d hits (2 effects per hit): uncached %.0f specs/s, cached %.0f specs/s"),
+				NumAttackers, NumCombos, GetHitTags().Num(), UncachedSpecsPerSecond, CachedSpecsPerSecond));
+		});
+	});
+}
@@ -0,0 +1,97 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCEffectHandleTrackingSpec, "GASCompanion.Runtime.GSCCoreComponent.EffectHandleTracking", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumSoakEffects = 1000000;
+	static constexpr int32 NumWarmupEffects = 1000;
+
+	FGSCTestWorld TestWorld;
+
+	const UGameplayEffect* Effect = nullptr;
+
+	void CreateWorld(const int32 MaxTrackedHandles = 1024)
+	{
+		TestWorld.Create(true, [MaxTrackedHandles](UGSCCoreComponent* CoreComponent)
+		{
+			CoreComponent->MaxTrackedGameplayEffectHandles = MaxTrackedHandles;
+		});
+
+		Effect = FGSCTestWorld::MakeEffect(TEXT("GSCInfiniteEffect"), { TestWorld.Attributes[0] }, 1.f, EGameplayEffectDurationType::Infinite);
+	}
+
+	FActiveGameplayEffectHandle ApplyEffect() const
+	{
+		UAbilitySystemComponent* ASC = TestWorld.AbilitySystemComponent;
+		return ASC->ApplyGameplayEffectToSelf(Effect, 1.f, ASC->MakeEffectContext());
+	}
+
+	void ApplyAndRemoveEffects(const int32 Count) const
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			TestWorld.AbilitySystemComponent->RemoveActiveGameplayEffect(ApplyEffect());
+		}
+	}
+
+END_DEFINE_SPEC(FGSCEffectHandleTrackingSpec)
+
+void FGSCEffectHandleTrackingSpec::Define()
+{
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Effect = nullptr;
+	});
+
+	It("should prune handles of removed effects", [this]()
+	{
+		CreateWorld();
+
+		const FActiveGameplayEffectHandle Handle = ApplyEffect();
+		TestEqual(TEXT("Tracked handles after apply"), TestWorld.CoreComponent->GetNumTrackedGameplayEffectHandles(), 1);
+
+		TestWorld.AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
+		TestEqual(TEXT("Tracked handles after remove"), TestWorld.CoreComponent->GetNumTrackedGameplayEffectHandles(), 0);
+	});
+
+	It("should not track more handles than MaxTrackedGameplayEffectHandles", [this]()
+	{
+		constexpr int32 MaxTrackedHandles = 8;
+		CreateWorld(MaxTrackedHandles);
+
+		TArray<FActiveGameplayEffectHandle> Handles;
+		for (int32 Index = 0; Index < MaxTrackedHandles * 2; ++Index)
+		{
+			Handles.Add(ApplyEffect());
+		}
+
+		TestEqual(TEXT("Tracked handles"), TestWorld.CoreComponent->GetNumTrackedGameplayEffectHandles(), MaxTrackedHandles);
+
+		for (const FActiveGameplayEffectHandle& Handle : Handles)
+		{
+			TestWorld.AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
+		}
+
+		TestEqual(TEXT("Tracked handles after remove"), TestWorld.CoreComponent->GetNumTrackedGameplayEffectHandles(), 0);
+	});
+
+	It("should keep a flat memory footprint after 1M applied effects", [this]()
+	{
+		CreateWorld();
+
+		ApplyAndRemoveEffects(NumWarmupEffects);
+		const SIZE_T WarmupAllocatedSize = TestWorld.CoreComponent->GetTrackedGameplayEffectHandlesAllocatedSize();
+
+		ApplyAndRemoveEffects(NumSoakEffects - NumWarmupEffects);
+		const SIZE_T SoakAllocatedSize = TestWorld.CoreComponent->GetTrackedGameplayEffectHandlesAllocatedSize();
+
+		TestEqual(TEXT("Tracked handles"), TestWorld.CoreComponent->GetNumTrackedGameplayEffectHandles(), 0);
+		TestEqual(TEXT("Allocated size"), SoakAllocatedSize, WarmupAllocatedSize);
+
+		AddInfo(FString::Printf(TEXT("%d applied effects: tracked handles allocated size %llu bytes (%llu bytes after %d effects)"),
+			NumSoakEffects, static_cast<uint64>(SoakAllocatedSize), static_cast<uint64>(WarmupAllocatedSize), NumWarmupEffects));
+	});
+}
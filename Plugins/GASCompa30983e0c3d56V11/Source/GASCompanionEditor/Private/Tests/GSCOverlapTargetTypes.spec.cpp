@@ -0,0 +1,294 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCTestTypes.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Abilities/TargetTypes/GSCTargetTypeBox.h"
+#include "Abilities/TargetTypes/GSCTargetTypeCapsule.h"
+#include "Abilities/TargetTypes/GSCTargetTypeCone.h"
+#include "Abilities/TargetTypes/GSCTargetTypeSphere.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGSCOverlapTargetTypesSpec, "GASCompanion.Runtime.GSCTargetType.Overlap", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumEnemies = 500;
+	static constexpr int32 NumQueries = 1000;
+
+	FGSCTestWorld TestWorld;
+	AGSCTestTargetActor* Source = nullptr;
+
+	AGSCTestTargetActor* SpawnActor(const FVector& Location) const
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return TestWorld.World->SpawnActor<AGSCTestTargetActor>(Location, FRotator::ZeroRotator, SpawnParameters);
+	}
+
+	AGSCTestTargetActor* SpawnTarget(const FVector& Location, const uint8 TeamId = 2, const bool bWithAbilitySystemComponent = true) const
+	{
+		AGSCTestTargetActor* Target = SpawnActor(Location);
+		Target->TeamId = FGenericTeamId(TeamId);
+		if (bWithAbilitySystemComponent)
+		{
+			Target->AddAbilitySystemComponent();
+		}
+
+		return Target;
+	}
+
+	template<typename T>
+	T* MakeTargetType() const
+	{
+		T* TargetType = NewObject<T>(GetTransientPackage());
+		TargetType->bRequireAbilitySystemComponent = false;
+		return TargetType;
+	}
+
+	TArray<AActor*> GetTargetActors(const UGSCTargetType* TargetType) const
+	{
+		FGameplayAbilityTargetDataHandle TargetData;
+		TargetType->AppendTargetData(Source, FGameplayEventData(), TargetData);
+
+		TArray<AActor*> Actors;
+		for (int32 Index = 0; Index < TargetData.Num(); ++Index)
+		{
+			for (const TWeakObjectPtr<AActor>& Actor : TargetData.Get(Index)->GetActors())
+			{
+				Actors.Add(Actor.Get());
+			}
+		}
+
+		return Actors;
+	}
+
+END_DEFINE_SPEC(FGSCOverlapTargetTypesSpec)
+
+void FGSCOverlapTargetTypesSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld.Create(false);
+		Source = SpawnActor(FVector::ZeroVector);
+		Source->TeamId = FGenericTeamId(1);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Destroy();
+		Source = nullptr;
+	});
+
+	It("should return the closest targets first, up to MaxTargets, in a single actor array", [this]()
+	{
+		AGSCTestTargetActor* Far = SpawnTarget(FVector(300.f, 0.f, 0.f));
+		AGSCTestTargetActor* Near = SpawnTarget(FVector(0.f, -100.f, 0.f));
+		AGSCTestTargetActor* Middle = SpawnTarget(FVector(-200.f, 0.f, 0.f));
+		SpawnTarget(FVector(1000.f, 0.f, 0.f));
+
+		UGSCTargetTypeSphere* Sphere = MakeTargetType<UGSCTargetTypeSphere>();
+		Sphere->Radius = 500.f;
+
+		FGameplayAbilityTargetDataHandle TargetData;
+		Sphere->AppendTargetData(Source, FGameplayEventData(), TargetData);
+		TestEqual(TEXT("Number of target data"), TargetData.Num(), 1);
+
+		const TArray<AActor*> Actors = GetTargetActors(Sphere);
+		if (TestEqual(TEXT("Number of targets"), Actors.Num(), 3))
+		{
+			TestTrue(TEXT("Closest target"), Actors[0] == Near);
+			TestTrue(TEXT("Second target"), Actors[1] == Middle);
+			TestTrue(TEXT("Third target"), Actors[2] == Far);
+		}
+
+		Sphere->MaxTargets = 2;
+		TestEqual(TEXT("Number of targets with MaxTargets"), GetTargetActors(Sphere).Num(), 2);
+
+		Sphere->bIncludeTargetingActor = true;
+		const TArray<AActor*> WithSource = GetTargetActors(Sphere);
+		TestTrue(TEXT("Targeting actor is included first"), WithSource.Num() > 0 && WithSource[0] == Source);
+	});
+
+	It("should sort targets at the same distance deterministically", [this]()
+	{
+		SpawnTarget(FVector(200.f, 0.f, 0.f));
+		SpawnTarget(FVector(-200.f, 0.f, 0.f));
+		SpawnTarget(FVector(0.f, 200.f, 0.f));
+		SpawnTarget(FVector(0.f, -200.f, 0.f));
+
+		UGSCTargetTypeSphere* Sphere = MakeTargetType<UGSCTargetTypeSphere>();
+		const TArray<AActor*> Actors = GetTargetActors(Sphere);
+
+		TestEqual(TEXT("Number of targets"), Actors.Num(), 4);
+		for (int32 Index = 1; Index < Actors.Num(); ++Index)
+		{
+			TestTrue(TEXT("Sorted by name"), Actors[Index - 1]->GetFName().LexicalLess(Actors[Index]->GetFName()));
+		}
+	});
+
+	It("should only keep targets within the cone angle", [this]()
+	{
+		AGSCTestTargetActor* Front = SpawnTarget(FVector(300.f, 100.f, 0.f));
+		SpawnTarget(FVector(0.f, 300.f, 0.f));
+		SpawnTarget(FVector(-300.f, 0.f, 0.f));
+
+		UGSCTargetTypeCone* Cone = MakeTargetType<UGSCTargetTypeCone>();
+		Cone->Range = 500.f;
+		Cone->HalfAngle = 45.f;
+
+		const TArray<AActor*> Actors = GetTargetActors(Cone);
+		TestTrue(TEXT("Only the target in front"), Actors.Num() == 1 && Actors[0] == Front);
+
+		Cone->HalfAngle = 180.f;
+		TestEqual(TEXT("Number of targets with a 360 degrees cone"), GetTargetActors(Cone).Num(), 3);
+	});
+
+	It("should keep targets whose collision reaches into the cone", [this]()
+	{
+		// Location is 46.8 degrees off the forward vector, but the 30 cm collision sphere reaches down to 44 degrees
+		AGSCTestTargetActor* Edge = SpawnTarget(FVector(300.f, 320.f, 0.f));
+		SpawnTarget(FVector(300.f, 400.f, 0.f));
+
+		UGSCTargetTypeCone* Cone = MakeTargetType<UGSCTargetTypeCone>();
+		Cone->Range = 500.f;
+		Cone->HalfAngle = 45.f;
+
+		const TArray<AActor*> Actors = GetTargetActors(Cone);
+		TestTrue(TEXT("Only the target reaching into the cone"), Actors.Num() == 1 && Actors[0] == Edge);
+	});
+
+	It("should query boxes and capsules oriented like the targeting actor", [this]()
+	{
+		SpawnTarget(FVector(0.f, 400.f, 0.f));
+		Source->SetActorRotation(FRotator(0.f, 90.f, 0.f));
+
+		UGSCTargetTypeBox* Box = MakeTargetType<UGSCTargetTypeBox>();
+		Box->HalfExtent = FVector(500.f, 50.f, 50.f);
+		TestEqual(TEXT("Number of targets in the rotated box"), GetTargetActors(Box).Num(), 1);
+
+		Source->SetActorRotation(FRotator::ZeroRotator);
+		TestEqual(TEXT("Number of targets in the box"), GetTargetActors(Box).Num(), 0);
+
+		UGSCTargetTypeCapsule* Capsule = MakeTargetType<UGSCTargetTypeCapsule>();
+		Capsule->Radius = 50.f;
+		Capsule->HalfHeight = 100.f;
+		Capsule->Offset = FVector(0.f, 400.f, 0.f);
+		TestEqual(TEXT("Number of targets in the offset capsule"), GetTargetActors(Capsule).Num(), 1);
+	});
+
+	It("should filter targets by ability system component and team", [this]()
+	{
+		AGSCTestTargetActor* Enemy = SpawnTarget(FVector(100.f, 0.f, 0.f), 2);
+		AGSCTestTargetActor* Ally = SpawnTarget(FVector(200.f, 0.f, 0.f), 1);
+		AGSCTestTargetActor* Neutral = SpawnTarget(FVector(300.f, 0.f, 0.f), FGenericTeamId::NoTeam.GetId());
+		SpawnTarget(FVector(400.f, 0.f, 0.f), 2, false);
+
+		UGSCTargetTypeSphere* Sphere = MakeTargetType<UGSCTargetTypeSphere>();
+		Sphere->Radius = 500.f;
+		TestEqual(TEXT("Number of targets without filter"), GetTargetActors(Sphere).Num(), 4);
+
+		Sphere->bRequireAbilitySystemComponent = true;
+		TestEqual(TEXT("Number of targets with an ASC"), GetTargetActors(Sphere).Num(), 3);
+
+		Sphere->TeamFilter = EGSCTargetTeamFilter::Hostile;
+		TArray<AActor*> Actors = GetTargetActors(Sphere);
+		TestTrue(TEXT("Hostile targets"), Actors.Num() == 1 && Actors[0] == Enemy);
+
+		Sphere->TeamFilter = EGSCTargetTeamFilter::Friendly;
+		Actors = GetTargetActors(Sphere);
+		TestTrue(TEXT("Friendly targets"), Actors.Num() == 1 && Actors[0] == Ally);
+
+		Sphere->TeamFilter = EGSCTargetTeamFilter::NotFriendly;
+		Actors = GetTargetActors(Sphere);
+		TestTrue(TEXT("Not friendly targets"), Actors.Num() == 2 && Actors[0] == Enemy && Actors[1] == Neutral);
+	});
+
+	It("should skip targets out of line of sight", [this]()
+	{
+		SpawnTarget(FVector(300.f, 0.f, 0.f));
+		AGSCTestTargetActor* Visible = SpawnTarget(FVector(0.f, 400.f, 0.f));
+
+		AGSCTestTargetActor* Wall = SpawnActor(FVector(150.f, 0.f, 0.f));
+		Wall->CollisionComponent->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+
+		UGSCTargetTypeSphere* Sphere = MakeTargetType<UGSCTargetTypeSphere>();
+		Sphere->Radius = 500.f;
+		Sphere->bRequireLineOfSight = true;
+		Sphere->MaxTargets = 1;
+
+		const TArray<AActor*> Actors = GetTargetActors(Sphere);
+		TestTrue(TEXT("Only the visible target"), Actors.Num() == 1 && Actors[0] == Visible);
+	});
+
+	It("should return the same targets from GetTargets", [this]()
+	{
+		SpawnTarget(FVector(100.f, 0.f, 0.f));
+		SpawnTarget(FVector(200.f, 0.f, 0.f));
+
+		UGSCTargetTypeSphere* Sphere = MakeTargetType<UGSCTargetTypeSphere>();
+
+		TArray<FHitResult> HitResults;
+		TArray<AActor*> Actors;
+		Sphere->GetTargets(Source, FGameplayEventData(), HitResults, Actors);
+		TestTrue(TEXT("Same targets"), Actors == GetTargetActors(Sphere));
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for a cone query among 500 enemies", [this]()
+		{
+			FRandomStream Random(1337);
+			for (int32 Index = 0; Index < NumEnemies; ++Index)
+			{
+				const FVector Direction = FVector(Random.FRandRange(-1.f, 1.f), Random.FRandRange(-1.f, 1.f), 0.f).GetSafeNormal();
+				SpawnTarget(Direction * Random.FRandRange(100.f, 2000.f), Random.RandRange(1, 2));
+			}
+
+			UGSCTargetTypeCone* Cone = MakeTargetType<UGSCTargetTypeCone>();
+			Cone->Range = 1500.f;
+			Cone->HalfAngle = 60.f;
+			Cone->bRequireAbilitySystemComponent = true;
+			Cone->TeamFilter = EGSCTargetTeamFilter::Hostile;
+
+			int64 NumTargets = 0;
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; ++Query)
+			{
+				TArray<FHitResult> HitResults;
+				TArray<AActor*> Actors;
+				Cone->GetTargets(Source, FGameplayEventData(), HitResults, Actors);
+
+				// What effect containers did with target type results before AppendTargetData
+				FGameplayAbilityTargetDataHandle TargetData;
+				FGameplayAbilityTargetData_ActorArray* NewData = new FGameplayAbilityTargetData_ActorArray();
+				NewData->TargetActorArray.Append(Actors);
+				TargetData.Add(NewData);
+				NumTargets += Actors.Num();
+			}
+			const double ArraysMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; ++Query)
+			{
+				FGameplayAbilityTargetDataHandle TargetData;
+				Cone->AppendTargetData(Source, FGameplayEventData(), TargetData);
+				NumTargets -= TargetData.Num() > 0 ? TargetData.Get(0)->GetActors().Num() : 0;
+			}
+			const double TargetDataMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TestEqual(TEXT("Same number of targets"), NumTargets, static_cast<int64>(0));
+
+			Cone->bRequireLineOfSight = true;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < NumQueries; ++Query)
+			{
+				FGameplayAbilityTargetDataHandle TargetData;
+				Cone->AppendTargetData(Source, FGameplayEventData(), TargetData);
+			}
+			const double LineOfSightMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			AddInfo(FString::Printf(TEXT("%d cone queries among %d enemies (%d targets per query): intermediate arrays %.2f ms, target data %.2f ms, with line of sight %.2f ms"),
+				NumQueries, NumEnemies, GetTargetActors(Cone).Num(), ArraysMs, TargetDataMs, LineOfSightMs));
+		});
+	});
+}
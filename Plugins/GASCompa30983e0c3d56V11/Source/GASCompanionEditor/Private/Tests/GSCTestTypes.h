@@ -0,0 +1,593 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "AttributeSet.h"
+#include "GameplayEffect.h"
+#include "Abilities/GameplayAbility.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "Components/GSCCoreComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameModeBase.h"
+#include "GenericTeamAgentInterface.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "GSCTestTypes.generated.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+
+// 5.4.x and down. Defined here once for every spec, so that unity builds don't see it twice.
+inline constexpr uint8 EAutomationTestFlags_ApplicationContextMask = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext;
+
+#endif
+
+/** Attribute Set with a large number of plain attributes, used by runtime specs and benchmarks */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestAttributeSet : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 NumAttributes = 40;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute00;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute01;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute02;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute03;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute04;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute05;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute06;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute07;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute08;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute09;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute10;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute11;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute12;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute13;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute14;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute15;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute16;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute17;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute18;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute19;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute20;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute21;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute22;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute23;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute24;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute25;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute26;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute27;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute28;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute29;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute30;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute31;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute32;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute33;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute34;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute35;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute36;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute37;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute38;
+
+	UPROPERTY()
+	FGameplayAttributeData Attribute39;
+};
+
+/** Counts OnAttributeChange / OnCoalescedAttributeChange broadcasts of a UGSCCoreComponent */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestAttributeListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 NumChanges = 0;
+	TMap<FGameplayAttribute, int32> NumChangesPerAttribute;
+	TMap<FGameplayAttribute, float> LastDeltaPerAttribute;
+
+	int32 NumCoalescedChanges = 0;
+	int32 LastNumMergedChanges = 0;
+	float LastOldValue = 0.f;
+	float LastNewValue = 0.f;
+
+	UFUNCTION()
+	void OnAttributeChange(FGameplayAttribute Attribute, float DeltaValue, const FGameplayTagContainer EventTags)
+	{
+		++NumChanges;
+		++NumChangesPerAttribute.FindOrAdd(Attribute);
+		LastDeltaPerAttribute.Add(Attribute, DeltaValue);
+	}
+
+	UFUNCTION()
+	void OnCoalescedAttributeChange(FGameplayAttribute Attribute, float OldValue, float NewValue, int32 NumMergedChanges)
+	{
+		++NumCoalescedChanges;
+		LastOldValue = OldValue;
+		LastNewValue = NewValue;
+		LastNumMergedChanges = NumMergedChanges;
+	}
+};
+
+/** Counts OnDamage / OnPostGameplayEffectExecute broadcasts of a UGSCCoreComponent */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestDamageListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 NumDamages = 0;
+	float LastDamageAmount = 0.f;
+	TWeakObjectPtr<AActor> LastSourceActor;
+
+	int32 NumExecutions = 0;
+
+	UFUNCTION()
+	void OnDamage(float DamageAmount, AActor* SourceCharacter, const FGameplayTagContainer& DamageTags)
+	{
+		++NumDamages;
+		LastDamageAmount = DamageAmount;
+		LastSourceActor = SourceCharacter;
+	}
+
+	UFUNCTION()
+	void OnPostGameplayEffectExecute(FGameplayAttribute Attribute, AActor* SourceActor, AActor* TargetActor, const FGameplayTagContainer& SourceTags, const FGSCGameplayEffectExecuteData Payload)
+	{
+		++NumExecutions;
+	}
+};
+
+/** Ability recording its activations in ActivationLog, and staying active until explicitly ended */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestRecordingAbility : public UGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	/** Classes of activated abilities, in activation order */
+	static inline TArray<UClass*> ActivationLog;
+
+	UGSCTestRecordingAbility()
+	{
+		InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+		NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
+	}
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override
+	{
+		Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+		ActivationLog.Add(GetClass());
+	}
+};
+
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestRecordingAbilityA : public UGSCTestRecordingAbility
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestRecordingAbilityB : public UGSCTestRecordingAbility
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestRecordingAbilityC : public UGSCTestRecordingAbility
+{
+	GENERATED_BODY()
+};
+
+/** Instant effect adding 1 to the first five attributes of UGSCTestAttributeSet */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestDamageEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestDamageEffect()
+	{
+		DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = FGameplayAttribute(FindFieldChecked<FProperty>(UGSCTestAttributeSet::StaticClass(), *FString::Printf(TEXT("Attribute%02d"), Index)));
+			Modifier.ModifierOp = EGameplayModOp::Additive;
+			Modifier.ModifierMagnitude = FScalableFloat(1.f);
+		}
+	}
+};
+
+/** Instant effect adding 1 to Attribute10 */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestHitEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestHitEffect()
+	{
+		DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = FGameplayAttribute(FindFieldChecked<FProperty>(UGSCTestAttributeSet::StaticClass(), TEXT("Attribute10")));
+		Modifier.ModifierOp = EGameplayModOp::Additive;
+		Modifier.ModifierMagnitude = FScalableFloat(1.f);
+	}
+};
+
+/** Plain UGSCGameplayAbility staying active until explicitly ended, effect containers are set up by specs */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestEffectContainerAbility : public UGSCGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestEffectContainerAbility()
+	{
+		InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+		NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
+	}
+};
+
+/** Cost effect with additive modifiers on Attribute00 and Attribute01, and a multiplicative one on Attribute02 */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestCostEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestCostEffect()
+	{
+		DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		const TPair<const TCHAR*, EGameplayModOp::Type> ModifierDefs[] = {
+			{ TEXT("Attribute00"), EGameplayModOp::Additive },
+			{ TEXT("Attribute01"), EGameplayModOp::Additive },
+			{ TEXT("Attribute02"), EGameplayModOp::Multiplicitive },
+		};
+
+		for (const TPair<const TCHAR*, EGameplayModOp::Type>& ModifierDef : ModifierDefs)
+		{
+			FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = FGameplayAttribute(FindFieldChecked<FProperty>(UGSCTestAttributeSet::StaticClass(), ModifierDef.Key));
+			Modifier.ModifierOp = ModifierDef.Value;
+			Modifier.ModifierMagnitude = FScalableFloat(-5.f);
+		}
+	}
+};
+
+/** Ability loosely checking UGSCTestCostEffect, exposing both cost check paths */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestCostAbility : public UGSCGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestCostAbility()
+	{
+		bLooselyCheckAbilityCost = true;
+		CostGameplayEffectClass = UGSCTestCostEffect::StaticClass();
+	}
+
+	bool CheckCostWithSpec(const FGameplayAbilityActorInfo* ActorInfo) const
+	{
+		return CanApplyPositiveAttributeModifiers(GetCostGameplayEffect(), ActorInfo, 1.f, ActorInfo->AbilitySystemComponent->MakeEffectContext());
+	}
+
+	bool CheckCostWithCompiledAttributes(const FGameplayAbilityActorInfo* ActorInfo) const
+	{
+		return CanApplyPositiveCostAttributes(GetCostGameplayEffect(), ActorInfo);
+	}
+};
+
+/** Local predicted melee ability without montages (ending right away), counting activations with authority */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UGSCTestComboAbility : public UGSCGameplayAbility_MeleeBase
+{
+	GENERATED_BODY()
+
+public:
+	static inline int32 NumAuthorityActivations = 0;
+
+	UGSCTestComboAbility()
+	{
+		InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+		NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+	}
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override
+	{
+		if (HasAuthority(&ActivationInfo))
+		{
+			++NumAuthorityActivations;
+		}
+
+		Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+	}
+};
+
+/** Character predicting combo advancement, granted UGSCTestComboAbility on possession */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class AGSCTestComboCharacter : public ACharacter, public IAbilitySystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<UGSCAbilitySystemComponent> AbilitySystemComponent;
+
+	UPROPERTY()
+	TObjectPtr<UGSCCoreComponent> CoreComponent;
+
+	UPROPERTY()
+	TObjectPtr<UGSCComboManagerComponent> ComboManagerComponent;
+
+	AGSCTestComboCharacter()
+	{
+		AbilitySystemComponent = CreateDefaultSubobject<UGSCAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+		AbilitySystemComponent->SetIsReplicated(true);
+
+		CoreComponent = CreateDefaultSubobject<UGSCCoreComponent>(TEXT("CoreComponent"));
+
+		ComboManagerComponent = CreateDefaultSubobject<UGSCComboManagerComponent>(TEXT("ComboManagerComponent"));
+		ComboManagerComponent->bPredictComboAdvancement = true;
+	}
+
+	//~ Begin IAbilitySystemInterface
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override
+	{
+		return AbilitySystemComponent;
+	}
+	//~ End IAbilitySystemInterface
+
+	virtual void BeginPlay() override
+	{
+		Super::BeginPlay();
+		AbilitySystemComponent->InitAbilityActorInfo(this, this);
+	}
+
+	virtual void PossessedBy(AController* NewController) override
+	{
+		Super::PossessedBy(NewController);
+		AbilitySystemComponent->InitAbilityActorInfo(this, this);
+		AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCTestComboAbility::StaticClass()));
+	}
+};
+
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class AGSCTestComboGameMode : public AGameModeBase
+{
+	GENERATED_BODY()
+
+public:
+	AGSCTestComboGameMode()
+	{
+		DefaultPawnClass = AGSCTestComboCharacter::StaticClass();
+	}
+};
+
+/** Actor with a sphere collision and a team, optionally owning an ASC, used by overlap target type specs */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class AGSCTestTargetActor : public AActor, public IGenericTeamAgentInterface
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<USphereComponent> CollisionComponent;
+
+	FGenericTeamId TeamId;
+
+	AGSCTestTargetActor()
+	{
+		CollisionComponent = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionComponent"));
+		CollisionComponent->InitSphereRadius(30.f);
+		CollisionComponent->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+		RootComponent = CollisionComponent;
+	}
+
+	void AddAbilitySystemComponent()
+	{
+		UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(this, TEXT("AbilitySystemComponent"));
+		ASC->RegisterComponent();
+		ASC->InitAbilityActorInfo(this, this);
+	}
+
+	//~ Begin IGenericTeamAgentInterface
+	virtual FGenericTeamId GetGenericTeamId() const override
+	{
+		return TeamId;
+	}
+
+	virtual ETeamAttitude::Type GetTeamAttitudeTowards(const AActor& Other) const override
+	{
+		const IGenericTeamAgentInterface* OtherTeamAgent = Cast<const IGenericTeamAgentInterface>(&Other);
+		if (!OtherTeamAgent || TeamId == FGenericTeamId::NoTeam || OtherTeamAgent->GetGenericTeamId() == FGenericTeamId::NoTeam)
+		{
+			return ETeamAttitude::Neutral;
+		}
+
+		return OtherTeamAgent->GetGenericTeamId() == TeamId ? ETeamAttitude::Friendly : ETeamAttitude::Hostile;
+	}
+	//~ End IGenericTeamAgentInterface
+};
+
+/** Headless game world with a single actor owning an ASC, a UGSCTestAttributeSet and (optionally) a UGSCCoreComponent */
+struct FGSCTestWorld
+{
+	UWorld* World = nullptr;
+	AActor* Actor = nullptr;
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCCoreComponent* CoreComponent = nullptr;
+	TArray<FGameplayAttribute> Attributes;
+
+	void Create(const bool bWithCoreComponent = true, const TFunction<void(UGSCCoreComponent*)>& ConfigureCoreComponent = nullptr)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GSCTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		Actor = World->SpawnActor<AActor>();
+
+		// Without a game mode, the world never begins play for its actors. Begin play on ours so that components registered
+		// below begin play as well, with their tick functions registered.
+		Actor->DispatchBeginPlay();
+
+		AbilitySystemComponent = NewObject<UAbilitySystemComponent>(Actor, TEXT("AbilitySystemComponent"));
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->AddSpawnedAttribute(NewObject<UGSCTestAttributeSet>(Actor));
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+		UGSCBlueprintFunctionLibrary::GetAllAttributes(UGSCTestAttributeSet::StaticClass(), Attributes);
+
+		if (bWithCoreComponent)
+		{
+			CoreComponent = NewObject<UGSCCoreComponent>(Actor, TEXT("CoreComponent"));
+			if (ConfigureCoreComponent)
+			{
+				ConfigureCoreComponent(CoreComponent);
+			}
+
+			CoreComponent->RegisterComponent();
+			CoreComponent->SetupOwner();
+			CoreComponent->RegisterAbilitySystemDelegates(AbilitySystemComponent);
+		}
+	}
+
+	void Destroy()
+	{
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		World = nullptr;
+		Actor = nullptr;
+		AbilitySystemComponent = nullptr;
+		CoreComponent = nullptr;
+		Attributes.Reset();
+	}
+
+	void Tick(const float DeltaTime) const
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	/** Builds a transient effect adding Magnitude to each of the given attributes */
+	static UGameplayEffect* MakeEffect(const FName Name, const TArray<FGameplayAttribute>& InAttributes, const float Magnitude, const EGameplayEffectDurationType DurationPolicy = EGameplayEffectDurationType::Instant, const float Period = 0.f)
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), Name);
+		Effect->DurationPolicy = DurationPolicy;
+
+		if (Period > 0.f)
+		{
+			Effect->Period = FScalableFloat(Period);
+			Effect->bExecutePeriodicEffectOnApplication = true;
+		}
+
+		for (const FGameplayAttribute& Attribute : InAttributes)
+		{
+			FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = Attribute;
+			Modifier.ModifierOp = EGameplayModOp::Additive;
+			Modifier.ModifierMagnitude = FScalableFloat(Magnitude);
+		}
+
+		return Effect;
+	}
+};
@@ -159,6 +159,126 @@ bool FGBAClampDefinition::GetValueForClamping(const UAttributeSet* InOwnerSet, f
 	return false;
 }
 
+bool FGBAClampingPlan::FBound::GetValue(const UAttributeSet* InOwnerSet, float& OutValue) const
+{
+	if (ClampType == EGBAClampingType::Float)
+	{
+		OutValue = Value;
+		return true;
+	}
+
+	if (ClampType == EGBAClampingType::AttributeBased)
+	{
+		OutValue = AttributeProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(InOwnerSet)->GetCurrentValue();
+		return true;
+	}
+
+	return false;
+}
+
+float FGBAClampingPlan::FEntry::Clamp(const UAttributeSet* InOwnerSet, const float InValue) const
+{
+	float Min;
+	const bool bIsMinValid = MinValue.GetValue(InOwnerSet, Min);
+
+	float Max;
+	const bool bIsMaxValid = MaxValue.GetValue(InOwnerSet, Max);
+
+	// Same rules as UGBAAttributeSetBlueprintBase::GetClampedValueForClampedProperty, invalid bounds are reported once when compiling the plan
+	if (bIsMinValid && bIsMaxValid)
+	{
+		return FMath::Clamp(InValue, Min, Max);
+	}
+
+	if (bIsMinValid)
+	{
+		return FMath::Max(InValue, Min);
+	}
+
+	if (bIsMaxValid)
+	{
+		return FMath::Min(InValue, Max);
+	}
+
+	return InValue;
+}
+
+FGBAClampingPlan::FGBAClampingPlan(const UAttributeSet* InDefaultObject)
+{
+	check(InDefaultObject);
+
+	const UClass* Class = InDefaultObject->GetClass();
+	EntryIndexBySlot.Init(INDEX_NONE, Class->GetPropertiesSize() / SlotSize + 1);
+
+	// Resolves a clamp definition, ensuring attribute based ones are attribute data members of Class (checked by FGBAClampDefinition::GetValueForClamping on each call)
+	auto CompileBound = [Class](const FGBAClampDefinition& InDefinition, FBound& OutBound)
+	{
+		OutBound.ClampType = InDefinition.ClampType;
+		OutBound.Value = InDefinition.Value;
+
+		if (InDefinition.ClampType != EGBAClampingType::AttributeBased)
+		{
+			return;
+		}
+
+		const FProperty* AttributeProperty = InDefinition.Attribute.GetUProperty();
+		if (!AttributeProperty || !FGameplayAttribute::IsGameplayAttributeDataProperty(AttributeProperty) || !Class->IsChildOf(AttributeProperty->GetOwnerStruct()))
+		{
+			if (InDefinition.Attribute.IsValid())
+			{
+				GBA_LOG(
+					Warning,
+					TEXT("FGBAClampingPlan - Unable to clamp based on attribute %s because it's not a Gameplay Attribute Data member of %s"),
+					*InDefinition.Attribute.GetName(),
+					*GetNameSafe(Class)
+				)
+			}
+
+			OutBound.ClampType = EGBAClampingType::None;
+			return;
+		}
+
+		OutBound.AttributeProperty = AttributeProperty;
+	};
+
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (!FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Property = Property;
+		EntryIndexBySlot[Property->GetOffset_ForInternal() / SlotSize] = Entries.Num() - 1;
+
+		if (!UGBAAttributeSetBlueprintBase::IsGameplayAttributeDataClampedProperty(Property))
+		{
+			continue;
+		}
+
+		const FGBAGameplayClampedAttributeData* Clamped = Property->ContainerPtrToValuePtr<FGBAGameplayClampedAttributeData>(InDefaultObject);
+		check(Clamped);
+
+		Entry.bIsClampedProperty = true;
+		CompileBound(Clamped->MinValue, Entry.MinValue);
+		CompileBound(Clamped->MaxValue, Entry.MaxValue);
+
+		if (Entry.MinValue.ClampType == EGBAClampingType::None && Entry.MaxValue.ClampType == EGBAClampingType::None)
+		{
+			GBA_LOG(
+				Warning,
+				TEXT("FGBAClampingPlan - Clamping for Gameplay Clamped Attribute %s.%s was disabled because Min and Max values are incorrrect (Min: %s, Max: %s)"),
+				*GetNameSafe(Class),
+				*Property->GetName(),
+				*Clamped->MinValue.ToString(),
+				*Clamped->MaxValue.ToString()
+			)
+		}
+	}
+}
+
 UGBAAttributeSetBlueprintBase::UGBAAttributeSetBlueprintBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -180,6 +300,12 @@ void UGBAAttributeSetBlueprintBase::PostEditChangeChainProperty(FPropertyChanged
 {
 	Super::PostEditChangeChainProperty(PropertyChangedEvent);
 
+	// Clamp definitions may have changed, have the plan compiled again for instances created from now on
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		ClampingPlan.Reset();
+	}
+
 	if (!PropertyChangedEvent.MemberProperty)
 	{
 		return;
@@ -320,23 +446,32 @@ void UGBAAttributeSetBlueprintBase::PrintDebug()
 
 bool UGBAAttributeSetBlueprintBase::PerformClampingForAttribute(const FGameplayAttribute& InAttribute, float& OutValue)
 {
+	const FGBAClampingPlan& Plan = GetClampingPlan();
+	const int32 EntryIndex = Plan.FindEntryIndex(InAttribute.GetUProperty());
+	if (EntryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
 	float NewValue = OutValue;
 	bool bWasClamped = false;
 
 	// First attempt clamp if it is a clamped property
-	if (IsValidClampedProperty(InAttribute))
+	const FGBAClampingPlan::FEntry& Entry = Plan.Entries[EntryIndex];
+	if (Entry.bIsClampedProperty)
 	{
-		NewValue = GetClampedValueForClampedProperty(InAttribute, NewValue);
+		NewValue = Entry.Clamp(this, NewValue);
 		bWasClamped = true;
 	}
-	
+
 	// Then runs clamping via metadata table, if this set was datatable initialized and has a corresponding row name
-	if (HasClampedMetaData(InAttribute))
+	if (ClampingPlanMetaData.IsValidIndex(EntryIndex) && IsValidAttributeMetadata(ClampingPlanMetaData[EntryIndex]))
 	{
-		NewValue = GetClampedValueForMetaData(InAttribute, NewValue);
+		const FAttributeMetaData& MetaData = *ClampingPlanMetaData[EntryIndex];
+		NewValue = FMath::Clamp(NewValue, MetaData.MinValue, MetaData.MaxValue);
 		bWasClamped = true;
 	}
-	
+
 	if (bWasClamped)
 	{
 		OutValue = NewValue;
@@ -345,6 +480,23 @@ bool UGBAAttributeSetBlueprintBase::PerformClampingForAttribute(const FGameplayA
 	return bWasClamped;
 }
 
+const FGBAClampingPlan& UGBAAttributeSetBlueprintBase::GetClampingPlan()
+{
+	if (!ClampingPlan.IsValid())
+	{
+		// Compiled from the CDO rather than in PostInitProperties, as Blueprint class defaults are only serialized afterward
+		UGBAAttributeSetBlueprintBase* CDO = GetClass()->GetDefaultObject<UGBAAttributeSetBlueprintBase>();
+		if (!CDO->ClampingPlan.IsValid())
+		{
+			CDO->ClampingPlan = MakeShared<FGBAClampingPlan>(CDO);
+		}
+
+		ClampingPlan = CDO->ClampingPlan;
+	}
+
+	return *ClampingPlan;
+}
+
 void UGBAAttributeSetBlueprintBase::ClampAttributeValue(const FGameplayAttribute Attribute, const float MinValue, const float MaxValue)
 {
 	bool bSuccessfullyFoundAttribute = true;
@@ -535,6 +687,7 @@ void UGBAAttributeSetBlueprintBase::HandleRepNotifyForGameplayClampedAttributeDa
 void UGBAAttributeSetBlueprintBase::BeginDestroy()
 {
 	AttributesMetaData.Empty();
+	ClampingPlanMetaData.Empty();
 	AttributeDataRepMap.Empty();
 	Super::BeginDestroy();
 }
@@ -980,6 +1133,14 @@ void UGBAAttributeSetBlueprintBase::InitDataTableProperties(const UDataTable* Da
 				TSharedRef<FAttributeMetaData> AttributeMetaData = MakeShared<FAttributeMetaData>(*MetaData);
 				AttributesMetaData.Add(Property->GetName(), AttributeMetaData);
 
+				const FGBAClampingPlan& Plan = GetClampingPlan();
+				const int32 EntryIndex = Plan.FindEntryIndex(Property);
+				if (EntryIndex != INDEX_NONE)
+				{
+					ClampingPlanMetaData.SetNum(Plan.Entries.Num());
+					ClampingPlanMetaData[EntryIndex] = AttributeMetaData;
+				}
+
 				// Since this initialization won't run into any of the code path for the attribute set (like PreAttributeChange)
 				//
 				// We ensure base value is clamped to its higher / lower bounds in the rare case that users set up a base value that is not within their
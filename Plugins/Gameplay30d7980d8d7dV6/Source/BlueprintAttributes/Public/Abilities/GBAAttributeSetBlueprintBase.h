@@ -174,6 +174,72 @@ struct BLUEPRINTATTRIBUTES_API FGBAGameplayClampedAttributeData : public FGamepl
 	}
 };
 
+/**
+ * Clamping rules of an Attribute Set class, compiled once from its class default object.
+ *
+ * Entries are indexed by attribute property offset, so that finding the rules of an attribute on every attribute change is a
+ * single array read, instead of property casts, attribute name lookups and class checks.
+ */
+struct BLUEPRINTATTRIBUTES_API FGBAClampingPlan
+{
+	/** Compiled FGBAClampDefinition */
+	struct FBound
+	{
+		/** Type of clamping to perform, None if the definition is disabled or invalid */
+		EGBAClampingType ClampType = EGBAClampingType::None;
+
+		/** Float value to clamp with, for Float clamping */
+		float Value = 0.f;
+
+		/** FGameplayAttributeData property to clamp with, for AttributeBased clamping (always a member of the plan's class) */
+		const FProperty* AttributeProperty = nullptr;
+
+		/** Returns whether the bound is valid, with its current value in OutValue */
+		bool GetValue(const UAttributeSet* InOwnerSet, float& OutValue) const;
+	};
+
+	/** Clamping rules of an FGameplayAttributeData property */
+	struct FEntry
+	{
+		const FProperty* Property = nullptr;
+
+		/** Whether the property is a FGBAGameplayClampedAttributeData (even with invalid bounds) */
+		bool bIsClampedProperty = false;
+
+		FBound MinValue;
+		FBound MaxValue;
+
+		/** Returns the new value for the attribute after clamping within MinValue / MaxValue */
+		float Clamp(const UAttributeSet* InOwnerSet, float InValue) const;
+	};
+
+	/** One entry per FGameplayAttributeData property of the class (including super classes) */
+	TArray<FEntry> Entries;
+
+	/** Compiles the plan from property defaults of InDefaultObject */
+	explicit FGBAClampingPlan(const UAttributeSet* InDefaultObject);
+
+	/** Returns the index of the entry for InProperty, or INDEX_NONE if it is not an FGameplayAttributeData property of the class */
+	int32 FindEntryIndex(const FProperty* InProperty) const
+	{
+		if (!InProperty)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Slot = InProperty->GetOffset_ForInternal() / SlotSize;
+		const int32 EntryIndex = EntryIndexBySlot.IsValidIndex(Slot) ? EntryIndexBySlot[Slot] : INDEX_NONE;
+		return EntryIndex != INDEX_NONE && Entries[EntryIndex].Property == InProperty ? EntryIndex : INDEX_NONE;
+	}
+
+private:
+	/** Attribute data properties can't share an offset slot, as they are at least that size */
+	static constexpr int32 SlotSize = alignof(FGameplayAttributeData);
+
+	/** Index in Entries for each offset slot of the class, INDEX_NONE for slots without an attribute data property */
+	TArray<int32> EntryIndexBySlot;
+};
+
 /**
  * Defines the set of all GameplayAttributes for your game.
  * 
@@ -332,6 +398,14 @@ public:
 	 */
 	bool PerformClampingForAttribute(const FGameplayAttribute& InAttribute, float& OutValue);
 
+	/**
+	 * Returns the clamping plan for this set's class, used by PerformClampingForAttribute.
+	 *
+	 * The plan is compiled from the class default object on first use (after Blueprint defaults are loaded), then shared by all
+	 * instances of the class.
+	 */
+	const FGBAClampingPlan& GetClampingPlan();
+
 	/**
 	 * Clamps the Attribute from MinValue to MaxValue
 	 *
@@ -474,6 +548,12 @@ protected:
 	/** Stores cached values of FAttributeMetaData that was read from an initialization data table during InitFromMetaDataTable() */
 	TMap<FString, TSharedPtr<FAttributeMetaData>> AttributesMetaData;
 
+	/** Same values as AttributesMetaData, indexed by clamping plan entry */
+	TArray<TSharedPtr<FAttributeMetaData>> ClampingPlanMetaData;
+
+	/** Clamping plan shared with the class default object, see GetClampingPlan() */
+	TSharedPtr<const FGBAClampingPlan> ClampingPlan;
+
 	/** List of valid rep notify handler for GameplayAttributes (HandleRepNotify...). Key is the CPP type, Value is the function name. */
 	static TMap<FString, FString> RepNotifierHandlerNames;
 	
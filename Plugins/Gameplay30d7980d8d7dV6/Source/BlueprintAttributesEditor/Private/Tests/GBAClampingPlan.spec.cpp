@@ -0,0 +1,135 @@
+// Copyright 2022-2024 Mickael Daniel. All Rights Reserved.
+
+#include "GBATestTypes.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(FGBAClampingPlanSpec, "BlueprintAttributes.Runtime.GBAAttributeSetBlueprintBase.ClampingPlan", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumModifications = 1000000;
+
+	UGBATestClampedAttributeSet* AttributeSet = nullptr;
+
+	/** Initializes AttributeSet from a meta data table clamping Mana between 0 and 10 */
+	void InitFromMetaDataTable() const
+	{
+		UDataTable* DataTable = NewObject<UDataTable>();
+		DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+
+		FAttributeMetaData MetaData;
+		MetaData.BaseValue = 5.f;
+		MetaData.MinValue = 0.f;
+		MetaData.MaxValue = 10.f;
+		DataTable->AddRow(TEXT("GBATestClampedAttributeSet.Mana"), MetaData);
+
+		AttributeSet->InitFromMetaDataTable(DataTable);
+	}
+
+	static TArray<FGameplayAttribute> GetAttributes()
+	{
+		return {
+			UGBATestClampedAttributeSet::GetAttribute(GET_MEMBER_NAME_CHECKED(UGBATestClampedAttributeSet, Health)),
+			UGBATestClampedAttributeSet::GetAttribute(GET_MEMBER_NAME_CHECKED(UGBATestClampedAttributeSet, MaxHealth)),
+			UGBATestClampedAttributeSet::GetAttribute(GET_MEMBER_NAME_CHECKED(UGBATestClampedAttributeSet, Stamina)),
+			UGBATestClampedAttributeSet::GetAttribute(GET_MEMBER_NAME_CHECKED(UGBATestClampedAttributeSet, Mana)),
+		};
+	}
+
+END_DEFINE_SPEC(FGBAClampingPlanSpec)
+
+void FGBAClampingPlanSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		AttributeSet = NewObject<UGBATestClampedAttributeSet>();
+		InitFromMetaDataTable();
+	});
+
+	AfterEach([this]()
+	{
+		AttributeSet = nullptr;
+	});
+
+	It("should compile one entry per attribute data property, shared across instances", [this]()
+	{
+		const FGBAClampingPlan& Plan = AttributeSet->GetClampingPlan();
+		TestEqual(TEXT("Number of entries"), Plan.Entries.Num(), GetAttributes().Num());
+
+		for (const FGameplayAttribute& Attribute : GetAttributes())
+		{
+			const int32 EntryIndex = Plan.FindEntryIndex(Attribute.GetUProperty());
+			TestTrue(FString::Printf(TEXT("Entry for %s"), *Attribute.GetName()), EntryIndex != INDEX_NONE && Plan.Entries[EntryIndex].Property == Attribute.GetUProperty());
+		}
+
+		// Lands in the same offset slot as Health, but belongs to another attribute set class
+		const FProperty* ForeignProperty = FindFieldChecked<FProperty>(UGBATestOtherAttributeSet::StaticClass(), GET_MEMBER_NAME_CHECKED(UGBATestOtherAttributeSet, Shield));
+		const FProperty* HealthProperty = UGBATestClampedAttributeSet::GetAttribute(GET_MEMBER_NAME_CHECKED(UGBATestClampedAttributeSet, Health)).GetUProperty();
+		TestEqual(TEXT("Offset of the other attribute set property"), ForeignProperty->GetOffset_ForInternal(), HealthProperty->GetOffset_ForInternal());
+		TestEqual(TEXT("Entry for a property of another attribute set"), Plan.FindEntryIndex(ForeignProperty), INDEX_NONE);
+
+		UGBATestClampedAttributeSet* Other = NewObject<UGBATestClampedAttributeSet>();
+		TestTrue(TEXT("Plan is shared"), &Other->GetClampingPlan() == &Plan);
+	});
+
+	It("should clamp like the uncompiled clamping", [this]()
+	{
+		const float Values[] = { -50.f, 0.f, 5.f, 50.f, 100.f, 150.f };
+		const float MaxHealthValues[] = { 20.f, 100.f };
+
+		for (const float MaxHealth : MaxHealthValues)
+		{
+			AttributeSet->MaxHealth.SetCurrentValue(MaxHealth);
+
+			for (const FGameplayAttribute& Attribute : GetAttributes())
+			{
+				for (const float Value : Values)
+				{
+					float Expected = Value;
+					const bool bExpectedClamped = AttributeSet->PerformClampingWithoutPlan(Attribute, Expected);
+
+					float Actual = Value;
+					const bool bClamped = AttributeSet->PerformClampingForAttribute(Attribute, Actual);
+
+					const FString What = FString::Printf(TEXT("%s with %.0f (MaxHealth: %.0f)"), *Attribute.GetName(), Value, MaxHealth);
+					TestEqual(*FString::Printf(TEXT("Clamped %s"), *What), bClamped, bExpectedClamped);
+					TestEqual(*FString::Printf(TEXT("Value %s"), *What), Actual, Expected);
+				}
+			}
+		}
+
+		float Mana = 50.f;
+		AttributeSet->PerformClampingForAttribute(GetAttributes()[3], Mana);
+		TestEqual(TEXT("Mana clamped by meta data"), Mana, 10.f);
+	});
+
+	Describe("Benchmark", [this]()
+	{
+		It("should report timings for 1M clamped modifications", [this]()
+		{
+			const FGameplayAttribute Health = GetAttributes()[0];
+			double Sum = 0.0;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumModifications; ++Index)
+			{
+				float Value = static_cast<float>(Index % 300) - 100.f;
+				AttributeSet->PerformClampingWithoutPlan(Health, Value);
+				Sum += Value;
+			}
+			const double UncompiledMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumModifications; ++Index)
+			{
+				float Value = static_cast<float>(Index % 300) - 100.f;
+				AttributeSet->PerformClampingForAttribute(Health, Value);
+				Sum -= Value;
+			}
+			const double CompiledMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TestEqual(TEXT("Same clamped values"), Sum, 0.0);
+			AddInfo(FString::Printf(TEXT("%d clamped modifications: uncompiled %.2f ms, clamping plan %.2f ms"), NumModifications, UncompiledMs, CompiledMs));
+		});
+	});
+}
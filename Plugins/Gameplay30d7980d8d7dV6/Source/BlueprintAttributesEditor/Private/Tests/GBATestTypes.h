@@ -0,0 +1,98 @@
+// Copyright 2022-2024 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GBAAttributeSetBlueprintBase.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "GBATestTypes.generated.h"
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+
+// 5.4.x and down. Defined here once for every spec, so that unity builds don't see it twice.
+inline constexpr uint8 EAutomationTestFlags_ApplicationContextMask = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext;
+
+#endif
+
+/** Attribute set with clamped attributes (float and attribute based bounds) and a plain attribute, used by automation tests */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGBATestClampedAttributeSet : public UGBAAttributeSetBlueprintBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Clamped between 0 and MaxHealth */
+	UPROPERTY()
+	FGBAGameplayClampedAttributeData Health;
+
+	UPROPERTY()
+	FGameplayAttributeData MaxHealth;
+
+	/** Clamped between 0 and 100 */
+	UPROPERTY()
+	FGBAGameplayClampedAttributeData Stamina;
+
+	/** Only clamped through metadata table */
+	UPROPERTY()
+	FGameplayAttributeData Mana;
+
+	UGBATestClampedAttributeSet()
+	{
+		Health.MinValue.ClampType = EGBAClampingType::Float;
+		Health.MinValue.Value = 0.f;
+		Health.MaxValue.ClampType = EGBAClampingType::AttributeBased;
+		Health.MaxValue.Attribute = GetAttribute(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHealth));
+
+		Stamina.MinValue.ClampType = EGBAClampingType::Float;
+		Stamina.MinValue.Value = 0.f;
+		Stamina.MaxValue.ClampType = EGBAClampingType::Float;
+		Stamina.MaxValue.Value = 100.f;
+
+		MaxHealth.SetBaseValue(100.f);
+		MaxHealth.SetCurrentValue(100.f);
+	}
+
+	static FGameplayAttribute GetAttribute(const FName InPropertyName)
+	{
+		return FGameplayAttribute(FindFieldChecked<FProperty>(StaticClass(), InPropertyName));
+	}
+
+	/** Clamping as PerformClampingForAttribute did before clamping plans, to compare results and timings */
+	bool PerformClampingWithoutPlan(const FGameplayAttribute& InAttribute, float& OutValue)
+	{
+		float NewValue = OutValue;
+		bool bWasClamped = false;
+
+		if (IsValidClampedProperty(InAttribute))
+		{
+			NewValue = GetClampedValueForClampedProperty(InAttribute, NewValue);
+			bWasClamped = true;
+		}
+
+		if (HasClampedMetaData(InAttribute))
+		{
+			NewValue = GetClampedValueForMetaData(InAttribute, NewValue);
+			bWasClamped = true;
+		}
+
+		if (bWasClamped)
+		{
+			OutValue = NewValue;
+		}
+
+		return bWasClamped;
+	}
+};
+
+/** Attribute set laid out like UGBATestClampedAttributeSet, so its attributes share offsets with the other set's attributes */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGBATestOtherAttributeSet : public UGBAAttributeSetBlueprintBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Same offset as UGBATestClampedAttributeSet::Health */
+	UPROPERTY()
+	FGameplayAttributeData Shield;
+};
@@ -0,0 +1,235 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ActiveEnemyRegistry.h"
+#include "GameFramework/Actor.h"
+
+FActiveEnemyHandle FActiveEnemyRegistry::Add(AActor* Enemy, AActor* Spawner)
+{
+	if (!Enemy)
+	{
+		return FActiveEnemyHandle();
+	}
+
+	const FObjectKey EnemyKey(Enemy);
+	if (slotByEnemy.Contains(EnemyKey))
+	{
+		return FActiveEnemyHandle();
+	}
+
+	const int32 Slot = freeSlots.Num() > 0 ? freeSlots.Pop(EAllowShrinking::No) : slots.AddDefaulted();
+	slots[Slot].DenseIndex = entries.Num();
+
+	FEntry& Entry = entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+	Entry.Spawner = Spawner;
+	Entry.EnemyKey = EnemyKey;
+	Entry.ClassKey = FObjectKey(Enemy->GetClass());
+	Entry.Slot = Slot;
+
+	slotByEnemy.Add(EnemyKey, Slot);
+	countByClass.FindOrAdd(Entry.ClassKey)++;
+
+	FActiveEnemyHandle Handle;
+	Handle.Slot = Slot;
+	Handle.Serial = slots[Slot].Serial;
+	return Handle;
+}
+
+bool FActiveEnemyRegistry::Remove(FActiveEnemyHandle Handle)
+{
+	if (!FindEntry(Handle))
+	{
+		return false;
+	}
+
+	RemoveAtDenseIndex(slots[Handle.Slot].DenseIndex);
+	return true;
+}
+
+bool FActiveEnemyRegistry::Remove(const AActor* Enemy)
+{
+	return Remove(FindHandle(Enemy));
+}
+
+FActiveEnemyHandle FActiveEnemyRegistry::FindHandle(const AActor* Enemy) const
+{
+	FActiveEnemyHandle Handle;
+	if (const int32* Slot = slotByEnemy.Find(FObjectKey(Enemy)))
+	{
+		Handle.Slot = *Slot;
+		Handle.Serial = slots[*Slot].Serial;
+	}
+	return Handle;
+}
+
+AActor* FActiveEnemyRegistry::Get(FActiveEnemyHandle Handle) const
+{
+	const FEntry* Entry = FindEntry(Handle);
+	return Entry ? Entry->Enemy.Get() : nullptr;
+}
+
+int32 FActiveEnemyRegistry::NumOfClass(const UClass* EnemyClass) const
+{
+	const int32* Count = countByClass.Find(FObjectKey(EnemyClass));
+	return Count ? *Count : 0;
+}
+
+int32 FActiveEnemyRegistry::RemoveStale()
+{
+	int32 NumRemoved = 0;
+	for (int32 DenseIndex = entries.Num() - 1; DenseIndex >= 0; DenseIndex--)
+	{
+		const FEntry& Entry = entries[DenseIndex];
+		if (!Entry.bPendingRemoval && !Entry.Enemy.IsValid())
+		{
+			RemoveAtDenseIndex(DenseIndex);
+			NumRemoved++;
+		}
+	}
+	return NumRemoved;
+}
+
+void FActiveEnemyRegistry::Reset()
+{
+	check(iterationDepth == 0);
+
+	entries.Reset();
+	slots.Reset();
+	freeSlots.Reset();
+	slotByEnemy.Reset();
+	countByClass.Reset();
+	pendingCompaction.Reset();
+}
+
+void FActiveEnemyRegistry::ForEach(TFunctionRef<void(AActor* Enemy)> Callback)
+{
+	iterationDepth++;
+
+	// Enemies added by the callback land past Count and are not visited. Entries are re-fetched by index every
+	// iteration since an Add can reallocate the array.
+	const int32 Count = entries.Num();
+	for (int32 DenseIndex = 0; DenseIndex < Count; DenseIndex++)
+	{
+		if (entries[DenseIndex].bPendingRemoval)
+		{
+			continue;
+		}
+
+		if (AActor* Enemy = entries[DenseIndex].Enemy.Get())
+		{
+			Callback(Enemy);
+		}
+	}
+
+	iterationDepth--;
+	if (iterationDepth == 0 && pendingCompaction.Num() > 0)
+	{
+		Compact();
+	}
+}
+
+void FActiveEnemyRegistry::GetEnemiesOfClass(const UClass* EnemyClass, TArray<AActor*>& OutEnemies) const
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : entries)
+	{
+		AActor* Enemy = Entry.Enemy.Get();
+		if (!Entry.bPendingRemoval && Enemy && Enemy->IsA(EnemyClass))
+		{
+			OutEnemies.Add(Enemy);
+		}
+	}
+}
+
+void FActiveEnemyRegistry::GetEnemiesFromSpawner(const AActor* Spawner, TArray<AActor*>& OutEnemies) const
+{
+	if (!Spawner)
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : entries)
+	{
+		AActor* Enemy = Entry.Enemy.Get();
+		if (!Entry.bPendingRemoval && Enemy && Entry.Spawner.Get() == Spawner)
+		{
+			OutEnemies.Add(Enemy);
+		}
+	}
+}
+
+const FActiveEnemyRegistry::FEntry* FActiveEnemyRegistry::FindEntry(FActiveEnemyHandle Handle) const
+{
+	if (!slots.IsValidIndex(Handle.Slot))
+	{
+		return nullptr;
+	}
+
+	const FSlot& Slot = slots[Handle.Slot];
+	if (Slot.Serial != Handle.Serial || Slot.DenseIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &entries[Slot.DenseIndex];
+}
+
+void FActiveEnemyRegistry::RemoveAtDenseIndex(int32 DenseIndex)
+{
+	FEntry& Entry = entries[DenseIndex];
+
+	slotByEnemy.Remove(Entry.EnemyKey);
+	if (int32* Count = countByClass.Find(Entry.ClassKey))
+	{
+		if (--(*Count) <= 0)
+		{
+			countByClass.Remove(Entry.ClassKey);
+		}
+	}
+
+	// Bumping the serial invalidates every outstanding handle to this slot
+	FSlot& Slot = slots[Entry.Slot];
+	Slot.DenseIndex = INDEX_NONE;
+	Slot.Serial++;
+	freeSlots.Add(Entry.Slot);
+	Entry.Slot = INDEX_NONE;
+
+	if (iterationDepth > 0)
+	{
+		Entry.bPendingRemoval = true;
+		pendingCompaction.Add(DenseIndex);
+		return;
+	}
+
+	const int32 LastIndex = entries.Num() - 1;
+	if (DenseIndex != LastIndex)
+	{
+		entries[DenseIndex] = MoveTemp(entries[LastIndex]);
+		slots[entries[DenseIndex].Slot].DenseIndex = DenseIndex;
+	}
+	entries.Pop(EAllowShrinking::No);
+}
+
+void FActiveEnemyRegistry::Compact()
+{
+	// Going from the back guarantees the element swapped into a hole is never itself pending removal
+	pendingCompaction.Sort(TGreater<int32>());
+
+	for (const int32 DenseIndex : pendingCompaction)
+	{
+		const int32 LastIndex = entries.Num() - 1;
+		if (DenseIndex != LastIndex)
+		{
+			entries[DenseIndex] = MoveTemp(entries[LastIndex]);
+			slots[entries[DenseIndex].Slot].DenseIndex = DenseIndex;
+		}
+		entries.Pop(EAllowShrinking::No);
+	}
+
+	pendingCompaction.Reset();
+}
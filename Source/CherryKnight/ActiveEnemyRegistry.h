@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "ActiveEnemyRegistry.generated.h"
+
+/** Handle to an enemy in the active enemy registry. Handles are invalidated when the enemy is removed, even if the slot is reused. */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FActiveEnemyHandle
+{
+	GENERATED_BODY()
+
+	int32 Slot = INDEX_NONE;
+	int32 Serial = 0;
+
+	bool IsValid() const { return Slot != INDEX_NONE; }
+
+	bool operator==(const FActiveEnemyHandle& Other) const { return Slot == Other.Slot && Serial == Other.Serial; }
+	bool operator!=(const FActiveEnemyHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Dense, weak-referenced set of the enemies currently alive in a wave.
+ *
+ * Enemies are stored contiguously and removed with a swap, while a slot table keeps handles stable, so insert, lookup and
+ * removal are all O(1). Enemies removed while iterating with ForEach are only compacted once iteration is done, so
+ * callbacks can safely remove any enemy (AoE kills) without skipping or revisiting entries.
+ */
+class CHERRYKNIGHT_API FActiveEnemyRegistry
+{
+public:
+	/** Registers an enemy and the spawner it came from. Returns an invalid handle if the enemy is null or already registered. */
+	FActiveEnemyHandle Add(AActor* Enemy, AActor* Spawner = nullptr);
+
+	bool Remove(FActiveEnemyHandle Handle);
+	bool Remove(const AActor* Enemy);
+
+	FActiveEnemyHandle FindHandle(const AActor* Enemy) const;
+	bool Contains(const AActor* Enemy) const { return FindHandle(Enemy).IsValid(); }
+
+	/** Returns the enemy for this handle, or null if the handle is stale or the enemy was garbage collected */
+	AActor* Get(FActiveEnemyHandle Handle) const;
+
+	/** Number of registered enemies, including ones that were destroyed without being removed (see RemoveStale) */
+	int32 Num() const { return entries.Num() - pendingCompaction.Num(); }
+
+	/** Number of registered enemies whose class is exactly EnemyClass, in O(1) */
+	int32 NumOfClass(const UClass* EnemyClass) const;
+
+	/** Removes every enemy that was destroyed or garbage collected without going through Remove. Returns the number removed. */
+	int32 RemoveStale();
+
+	void Reset();
+
+	/** Calls Callback for every live enemy, in registration order modulo swap-removals. Callback may remove enemies. */
+	void ForEach(TFunctionRef<void(AActor* Enemy)> Callback);
+
+	/** Appends every live enemy of EnemyClass (or one of its subclasses) to OutEnemies */
+	void GetEnemiesOfClass(const UClass* EnemyClass, TArray<AActor*>& OutEnemies) const;
+
+	/** Appends every live enemy spawned by Spawner to OutEnemies */
+	void GetEnemiesFromSpawner(const AActor* Spawner, TArray<AActor*>& OutEnemies) const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Enemy;
+		TWeakObjectPtr<AActor> Spawner;
+		FObjectKey EnemyKey;
+		FObjectKey ClassKey;
+		int32 Slot = INDEX_NONE;
+		bool bPendingRemoval = false;
+	};
+
+	struct FSlot
+	{
+		int32 DenseIndex = INDEX_NONE;
+		int32 Serial = 0;
+	};
+
+	const FEntry* FindEntry(FActiveEnemyHandle Handle) const;
+	void RemoveAtDenseIndex(int32 DenseIndex);
+	void Compact();
+
+	TArray<FEntry> entries;
+	TArray<FSlot> slots;
+	TArray<int32> freeSlots;
+	TMap<FObjectKey, int32> slotByEnemy;
+	TMap<FObjectKey, int32> countByClass;
+
+	/** Dense indices of entries removed during iteration, compacted once the outermost ForEach returns */
+	TArray<int32> pendingCompaction;
+	int32 iterationDepth = 0;
+};
@@ -3,4 +3,6 @@
 #include "CherryKnight.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogCherryKnightWaves);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, CherryKnight, "CherryKnight" );
@@ -0,0 +1,230 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyPool.h"
+#include "PooledEnemy_Interface.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void UEnemyPool::SetCapacity(TSubclassOf<AActor> EnemyClass, int32 Capacity)
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	FEnemyPoolBucket& Bucket = buckets.FindOrAdd(EnemyClass);
+	Bucket.Capacity = FMath::Max(0, Capacity);
+
+	while (Bucket.InactiveEnemies.Num() > Bucket.Capacity)
+	{
+		if (AActor* Enemy = Bucket.InactiveEnemies.Pop(EAllowShrinking::No))
+		{
+			Enemy->Destroy();
+		}
+	}
+}
+
+int32 UEnemyPool::GetCapacity(TSubclassOf<AActor> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = buckets.Find(EnemyClass);
+	return Bucket ? Bucket->Capacity : 0;
+}
+
+void UEnemyPool::WarmUp(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	for (TPair<TSubclassOf<AActor>, FEnemyPoolBucket>& Pair : buckets)
+	{
+		FEnemyPoolBucket& Bucket = Pair.Value;
+
+		// Drop anything that was destroyed behind our back (level travel, BP calling DestroyActor...)
+		Bucket.InactiveEnemies.RemoveAll([](const AActor* Enemy) { return !IsValid(Enemy); });
+		Bucket.InactiveEnemies.Reserve(Bucket.Capacity);
+
+		while (Bucket.InactiveEnemies.Num() < Bucket.Capacity)
+		{
+			AActor* Enemy = SpawnEnemy(World, Pair.Key, FTransform::Identity);
+			if (!Enemy)
+			{
+				break;
+			}
+
+			DeactivateEnemy(Enemy);
+			Bucket.InactiveEnemies.Add(Enemy);
+		}
+	}
+}
+
+AActor* UEnemyPool::Acquire(UWorld* World, TSubclassOf<AActor> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!World || !EnemyClass)
+	{
+		return nullptr;
+	}
+
+	FEnemyPoolBucket& Bucket = buckets.FindOrAdd(EnemyClass);
+
+	AActor* Enemy = nullptr;
+	while (!Enemy && Bucket.InactiveEnemies.Num() > 0)
+	{
+		AActor* Candidate = Bucket.InactiveEnemies.Pop(EAllowShrinking::No);
+		if (IsValid(Candidate))
+		{
+			Enemy = Candidate;
+		}
+	}
+
+	if (Enemy)
+	{
+		Bucket.Stats.Hits++;
+		ActivateEnemy(Enemy, SpawnTransform);
+	}
+	else
+	{
+		Enemy = SpawnEnemy(World, EnemyClass, SpawnTransform);
+		if (!Enemy)
+		{
+			return nullptr;
+		}
+		Bucket.Stats.Misses++;
+	}
+
+	Bucket.NumActive++;
+	Bucket.Stats.HighWaterMark = FMath::Max(Bucket.Stats.HighWaterMark, Bucket.NumActive);
+	totalActive++;
+	totalHighWaterMark = FMath::Max(totalHighWaterMark, totalActive);
+
+	if (Enemy->Implements<UPooledEnemy_Interface>())
+	{
+		IPooledEnemy_Interface::Execute_OnAcquiredFromPool(Enemy);
+	}
+
+	return Enemy;
+}
+
+bool UEnemyPool::Release(AActor* Enemy)
+{
+	// Enemies removing themselves from Event Destroyed are on their way out, the pool would later hand out a dead actor
+	if (!IsValid(Enemy) || Enemy->IsActorBeingDestroyed())
+	{
+		return false;
+	}
+
+	FEnemyPoolBucket* Bucket = buckets.Find(Enemy->GetClass());
+	if (!Bucket)
+	{
+		return false;
+	}
+
+	// Enemies spawned outside of the pool can still be recycled, so don't let the active count go negative
+	if (Bucket->NumActive > 0)
+	{
+		Bucket->NumActive--;
+		totalActive--;
+	}
+
+	if (Bucket->InactiveEnemies.Num() >= Bucket->Capacity)
+	{
+		Bucket->Stats.Discards++;
+		return false;
+	}
+
+	if (Enemy->Implements<UPooledEnemy_Interface>())
+	{
+		IPooledEnemy_Interface::Execute_OnReturnedToPool(Enemy);
+	}
+
+	DeactivateEnemy(Enemy);
+	Bucket->InactiveEnemies.Add(Enemy);
+	Bucket->Stats.Returns++;
+	return true;
+}
+
+bool UEnemyPool::IsPooled(const AActor* Enemy) const
+{
+	if (!Enemy)
+	{
+		return false;
+	}
+
+	const FEnemyPoolBucket* Bucket = buckets.Find(Enemy->GetClass());
+	return Bucket && Bucket->InactiveEnemies.Contains(Enemy);
+}
+
+void UEnemyPool::DestroyInactiveEnemies()
+{
+	for (TPair<TSubclassOf<AActor>, FEnemyPoolBucket>& Pair : buckets)
+	{
+		for (AActor* Enemy : Pair.Value.InactiveEnemies)
+		{
+			if (IsValid(Enemy))
+			{
+				Enemy->Destroy();
+			}
+		}
+		Pair.Value.InactiveEnemies.Reset();
+	}
+}
+
+FEnemyPoolStats UEnemyPool::GetStats(TSubclassOf<AActor> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = buckets.Find(EnemyClass);
+	return Bucket ? Bucket->Stats : FEnemyPoolStats();
+}
+
+FEnemyPoolStats UEnemyPool::GetTotalStats() const
+{
+	FEnemyPoolStats Total;
+	for (const TPair<TSubclassOf<AActor>, FEnemyPoolBucket>& Pair : buckets)
+	{
+		Total.Hits += Pair.Value.Stats.Hits;
+		Total.Misses += Pair.Value.Stats.Misses;
+		Total.Returns += Pair.Value.Stats.Returns;
+		Total.Discards += Pair.Value.Stats.Discards;
+	}
+	Total.HighWaterMark = totalHighWaterMark;
+	return Total;
+}
+
+AActor* UEnemyPool::SpawnEnemy(UWorld* World, TSubclassOf<AActor> EnemyClass, const FTransform& SpawnTransform)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	return World->SpawnActor<AActor>(EnemyClass, SpawnTransform, SpawnParameters);
+}
+
+void UEnemyPool::ActivateEnemy(AActor* Enemy, const FTransform& SpawnTransform)
+{
+	Enemy->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	Enemy->SetActorHiddenInGame(false);
+	Enemy->SetActorEnableCollision(true);
+	Enemy->SetActorTickEnabled(Enemy->PrimaryActorTick.bStartWithTickEnabled);
+
+	for (UActorComponent* Component : Enemy->GetComponents())
+	{
+		if (Component)
+		{
+			Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+	}
+}
+
+void UEnemyPool::DeactivateEnemy(AActor* Enemy)
+{
+	Enemy->SetActorHiddenInGame(true);
+	Enemy->SetActorEnableCollision(false);
+	Enemy->SetActorTickEnabled(false);
+
+	for (UActorComponent* Component : Enemy->GetComponents())
+	{
+		if (Component)
+		{
+			Component->SetComponentTickEnabled(false);
+		}
+	}
+}
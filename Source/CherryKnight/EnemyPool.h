@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Templates/SubclassOf.h"
+#include "EnemyPool.generated.h"
+
+/** Counters for an enemy pool, either for a single enemy class or summed up over the whole pool */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FEnemyPoolStats
+{
+	GENERATED_BODY()
+
+	/** Number of acquisitions served by an already constructed, inactive enemy */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 Hits = 0;
+
+	/** Number of acquisitions that had to spawn a brand new enemy */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 Misses = 0;
+
+	/** Number of enemies put back in the pool instead of being destroyed */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 Returns = 0;
+
+	/** Number of enemies that could not be put back in the pool because it was already full */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 Discards = 0;
+
+	/** Highest number of enemies handed out by the pool at the same time */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 HighWaterMark = 0;
+};
+
+/** Per class storage of the enemy pool */
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	/** Constructed but deactivated enemies, ready to be handed out */
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> InactiveEnemies;
+
+	/** Maximum number of inactive enemies kept around for this class */
+	int32 Capacity = 0;
+
+	/** Number of enemies of this class currently handed out by the pool */
+	int32 NumActive = 0;
+
+	FEnemyPoolStats Stats;
+};
+
+/**
+ * Pre-warmed pool of enemy actors, owned by the wave manager.
+ *
+ * Enemies are deactivated (hidden, no collision, no tick) and kept around when they die instead of being destroyed,
+ * so the next wave doesn't have to pay for actor construction, component registration and ability grants again.
+ *
+ * Enemies implementing IPooledEnemy_Interface are notified when they go in and out of the pool to reset their state.
+ */
+UCLASS()
+class CHERRYKNIGHT_API UEnemyPool : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Sets how many inactive enemies of the given class the pool keeps. Extra inactive enemies are destroyed. */
+	void SetCapacity(TSubclassOf<AActor> EnemyClass, int32 Capacity);
+
+	int32 GetCapacity(TSubclassOf<AActor> EnemyClass) const;
+
+	/** Spawns and deactivates enemies until every class with a capacity has a full pool */
+	void WarmUp(UWorld* World);
+
+	/** Returns a reactivated enemy from the pool, or spawns a new one if the pool is empty for this class */
+	AActor* Acquire(UWorld* World, TSubclassOf<AActor> EnemyClass, const FTransform& SpawnTransform);
+
+	/**
+	 * Deactivates the enemy and puts it back in the pool.
+	 *
+	 * @return false if the pool is full (or has no capacity) for this enemy class, or if the enemy is being destroyed, in which case the enemy is left untouched
+	 */
+	bool Release(AActor* Enemy);
+
+	/** Returns true if the enemy is currently deactivated and sitting in the pool */
+	bool IsPooled(const AActor* Enemy) const;
+
+	/** Destroys every inactive enemy. Capacities and stats are kept. */
+	void DestroyInactiveEnemies();
+
+	FEnemyPoolStats GetStats(TSubclassOf<AActor> EnemyClass) const;
+
+	/** Returns the stats of every class summed up. HighWaterMark is the peak of all classes combined. */
+	FEnemyPoolStats GetTotalStats() const;
+
+private:
+	static AActor* SpawnEnemy(UWorld* World, TSubclassOf<AActor> EnemyClass, const FTransform& SpawnTransform);
+	static void ActivateEnemy(AActor* Enemy, const FTransform& SpawnTransform);
+	static void DeactivateEnemy(AActor* Enemy);
+
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, FEnemyPoolBucket> buckets;
+
+	int32 totalActive = 0;
+	int32 totalHighWaterMark = 0;
+};
@@ -0,0 +1,6 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PooledEnemy_Interface.h"
+
+// Add default functionality here for any IPooledEnemy_Interface functions that are not pure virtual.
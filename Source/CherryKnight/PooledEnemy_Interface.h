@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "PooledEnemy_Interface.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI)
+class UPooledEnemy_Interface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional interface for enemies managed by the wave manager's enemy pool.
+ *
+ * Pooled enemies are never destroyed between waves, so any per-life state (health, AI blackboard, active effects...)
+ * has to be reset by the enemy itself when it goes back into the pool or comes back out of it.
+ */
+class CHERRYKNIGHT_API IPooledEnemy_Interface
+{
+	GENERATED_BODY()
+
+public:
+	/** Called after the enemy has been taken out of the pool, moved to its spawn transform and reactivated */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Wave Management")
+	void OnAcquiredFromPool();
+
+	/** Called right before the enemy is hidden, has its collision and tick disabled and is put back in the pool */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Wave Management")
+	void OnReturnedToPool();
+};
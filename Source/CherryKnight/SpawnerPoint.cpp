@@ -2,12 +2,17 @@
 
 
 #include "SpawnerPoint.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
 
 // Sets default values
 ASpawnerPoint::ASpawnerPoint()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// Spawners are driven by the wave manager, they have nothing to do every frame. Blueprint children that need Event Tick have to turn this back on.
+	PrimaryActorTick.bCanEverTick = false;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 }
 
@@ -15,14 +20,18 @@ ASpawnerPoint::ASpawnerPoint()
 void ASpawnerPoint::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	if (bUseSignificanceActivation)
+	{
+		Sleep();
+	}
 }
 
-// Called every frame
-void ASpawnerPoint::Tick(float DeltaTime)
+void ASpawnerPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	GetWorldTimerManager().ClearTimer(SleepCheckTimer);
 
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASpawnerPoint::SpawnEnemy()
@@ -30,3 +39,69 @@ void ASpawnerPoint::SpawnEnemy()
 
 }
 
+void ASpawnerPoint::WakeUp()
+{
+	if (!bAsleep)
+	{
+		return;
+	}
+
+	bAsleep = false;
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	for (UActorComponent* Component : GetComponents())
+	{
+		if (Component)
+		{
+			Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+	}
+
+	GetWorldTimerManager().SetTimer(SleepCheckTimer, this, &ASpawnerPoint::CheckSleep, SleepCheckInterval, true);
+
+	K2_OnWokenUp();
+}
+
+void ASpawnerPoint::Sleep()
+{
+	if (bAsleep)
+	{
+		return;
+	}
+
+	bAsleep = true;
+	SetActorTickEnabled(false);
+	for (UActorComponent* Component : GetComponents())
+	{
+		if (Component)
+		{
+			Component->SetComponentTickEnabled(false);
+		}
+	}
+
+	GetWorldTimerManager().ClearTimer(SleepCheckTimer);
+
+	K2_OnFallenAsleep();
+}
+
+void ASpawnerPoint::CheckSleep()
+{
+	if (!IsAnyPlayerInWakeRange())
+	{
+		Sleep();
+	}
+}
+
+bool ASpawnerPoint::IsAnyPlayerInWakeRange() const
+{
+	const double WakeRangeSquared = FMath::Square<double>(WakeRange);
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (Pawn && FVector::DistSquared(Pawn->GetActorLocation(), GetActorLocation()) <= WakeRangeSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -19,11 +19,46 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Spawn Enemy"), Category = "Wave Management")
 	void SpawnEnemy();
 
+	/**
+	 * When enabled, the spawner starts asleep (actor and components don't tick) and is only woken up by the wave manager
+	 * when it picks this spawner. It goes back to sleep once no player is within WakeRange.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management|Significance")
+	bool bUseSignificanceActivation = false;
+
+	/** Distance to the closest player under which an awake spawner stays awake */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management|Significance", meta = (EditCondition = "bUseSignificanceActivation", ClampMin = 0))
+	float WakeRange = 8000.f;
+
+	/** Seconds between two checks of whether an awake spawner can go back to sleep */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management|Significance", meta = (EditCondition = "bUseSignificanceActivation", ClampMin = 0.1))
+	float SleepCheckInterval = 5.f;
+
+	/** Wakes the spawner up if it is asleep. Called by the wave manager before asking this spawner to spawn. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Wake Up"), Category = "Wave Management|Significance")
+	void WakeUp();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Asleep"), Category = "Wave Management|Significance")
+	bool IsAsleep() const { return bAsleep; }
+
+protected:
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "On Woken Up"), Category = "Wave Management|Significance")
+	void K2_OnWokenUp();
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "On Fallen Asleep"), Category = "Wave Management|Significance")
+	void K2_OnFallenAsleep();
+
+private:
+	void Sleep();
+	void CheckSleep();
+	bool IsAnyPlayerInWakeRange() const;
+
+	bool bAsleep = false;
+	FTimerHandle SleepCheckTimer;
 };
@@ -0,0 +1,232 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SpawnerSpatialIndex.h"
+#include "GameFramework/Actor.h"
+
+FSpawnerSpatialIndex::FSpawnerSpatialIndex(float InCellSize)
+	: cellSize(FMath::Max(InCellSize, 1.f))
+{
+}
+
+bool FSpawnerSpatialIndex::Add(AActor* Spawner)
+{
+	if (!Spawner || lookup.Contains(FObjectKey(Spawner)))
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = freeEntries.Num() > 0 ? freeEntries.Pop(EAllowShrinking::No) : entries.AddDefaulted();
+
+	FEntry& Entry = entries[EntryIndex];
+	Entry.Spawner = Spawner;
+	Entry.Location = Spawner->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+	Entry.bEnabled = true;
+	Entry.bAllocated = true;
+
+	lookup.Add(FObjectKey(Spawner), EntryIndex);
+	AddToCell(EntryIndex);
+	return true;
+}
+
+bool FSpawnerSpatialIndex::Remove(const AActor* Spawner)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!lookup.RemoveAndCopyValue(FObjectKey(Spawner), EntryIndex))
+	{
+		return false;
+	}
+
+	RemoveFromCell(EntryIndex);
+	entries[EntryIndex] = FEntry();
+	freeEntries.Add(EntryIndex);
+	return true;
+}
+
+void FSpawnerSpatialIndex::Reset()
+{
+	entries.Reset();
+	freeEntries.Reset();
+	lookup.Reset();
+	cells.Reset();
+}
+
+bool FSpawnerSpatialIndex::SetEnabled(const AActor* Spawner, bool bEnabled)
+{
+	const int32* EntryIndex = lookup.Find(FObjectKey(Spawner));
+	if (!EntryIndex)
+	{
+		return false;
+	}
+
+	entries[*EntryIndex].bEnabled = bEnabled;
+	return true;
+}
+
+bool FSpawnerSpatialIndex::IsEnabled(const AActor* Spawner) const
+{
+	const int32* EntryIndex = lookup.Find(FObjectKey(Spawner));
+	return EntryIndex && entries[*EntryIndex].bEnabled;
+}
+
+bool FSpawnerSpatialIndex::UpdateLocation(const AActor* Spawner)
+{
+	const int32* EntryIndex = lookup.Find(FObjectKey(Spawner));
+	if (!EntryIndex || !Spawner)
+	{
+		return false;
+	}
+
+	FEntry& Entry = entries[*EntryIndex];
+	Entry.Location = Spawner->GetActorLocation();
+
+	const FIntPoint NewCell = GetCell(Entry.Location);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(*EntryIndex);
+		Entry.Cell = NewCell;
+		AddToCell(*EntryIndex);
+	}
+	return true;
+}
+
+void FSpawnerSpatialIndex::QueryNearest(const FSpawnerQuery& Query, TArray<AActor*>& OutSpawners) const
+{
+	if (Query.MaxResults <= 0 || Query.Viewers.Num() == 0 || lookup.Num() == 0)
+	{
+		return;
+	}
+
+	uint32 Stamp = ++queryStamp;
+	if (Stamp == 0)
+	{
+		// Wrapped around, old stamps could collide with the new ones
+		for (const FEntry& Entry : entries)
+		{
+			Entry.QueryStamp = 0;
+		}
+		Stamp = ++queryStamp;
+	}
+
+	const double MinRangeSquared = FMath::Square(FMath::Max<double>(Query.MinRange, 0.0));
+	const double MaxRangeSquared = FMath::Square<double>(Query.MaxRange);
+
+	struct FCandidate
+	{
+		double DistanceSquared;
+		int32 EntryIndex;
+	};
+
+	// Max-heap on distance holding the best MaxResults candidates found so far
+	const auto FurthestFirst = [](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared > B.DistanceSquared; };
+	TArray<FCandidate, TInlineAllocator<32>> Best;
+
+	const auto VisitEntry = [&](int32 EntryIndex)
+	{
+		const FEntry& Entry = entries[EntryIndex];
+		if (Entry.QueryStamp == Stamp)
+		{
+			return;
+		}
+		Entry.QueryStamp = Stamp;
+
+		if (!Entry.bEnabled || !Entry.bAllocated)
+		{
+			return;
+		}
+
+		double ClosestSquared = TNumericLimits<double>::Max();
+		for (const FSpawnerQueryViewer& Viewer : Query.Viewers)
+		{
+			const FVector Delta = Entry.Location - Viewer.Location;
+			const double DistanceSquared = Delta.SizeSquared();
+			ClosestSquared = FMath::Min(ClosestSquared, DistanceSquared);
+
+			if (Query.bExcludeInView && DistanceSquared > UE_KINDA_SMALL_NUMBER && (Delta.GetUnsafeNormal() | Viewer.Direction) >= Viewer.CosHalfFOV)
+			{
+				return;
+			}
+		}
+
+		if (ClosestSquared < MinRangeSquared || ClosestSquared > MaxRangeSquared || !Entry.Spawner.IsValid())
+		{
+			return;
+		}
+
+		if (Best.Num() < Query.MaxResults)
+		{
+			Best.HeapPush({ ClosestSquared, EntryIndex }, FurthestFirst);
+		}
+		else if (ClosestSquared < Best.HeapTop().DistanceSquared)
+		{
+			Best.HeapPopDiscard(FurthestFirst, EAllowShrinking::No);
+			Best.HeapPush({ ClosestSquared, EntryIndex }, FurthestFirst);
+		}
+	};
+
+	for (const FSpawnerQueryViewer& Viewer : Query.Viewers)
+	{
+		const FIntPoint MinCell = GetCell(Viewer.Location - FVector(Query.MaxRange));
+		const FIntPoint MaxCell = GetCell(Viewer.Location + FVector(Query.MaxRange));
+		const int64 NumCellsInRange = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+		if (NumCellsInRange > cells.Num())
+		{
+			// The range covers more cells than are populated, walking the populated ones is cheaper
+			for (const TPair<FIntPoint, TArray<int32>>& Cell : cells)
+			{
+				for (const int32 EntryIndex : Cell.Value)
+				{
+					VisitEntry(EntryIndex);
+				}
+			}
+			continue;
+		}
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				if (const TArray<int32>* Cell = cells.Find(FIntPoint(X, Y)))
+				{
+					for (const int32 EntryIndex : *Cell)
+					{
+						VisitEntry(EntryIndex);
+					}
+				}
+			}
+		}
+	}
+
+	Best.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared < B.DistanceSquared; });
+
+	OutSpawners.Reserve(OutSpawners.Num() + Best.Num());
+	for (const FCandidate& Candidate : Best)
+	{
+		OutSpawners.Add(entries[Candidate.EntryIndex].Spawner.Get());
+	}
+}
+
+FIntPoint FSpawnerSpatialIndex::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / cellSize), FMath::FloorToInt32(Location.Y / cellSize));
+}
+
+void FSpawnerSpatialIndex::AddToCell(int32 EntryIndex)
+{
+	cells.FindOrAdd(entries[EntryIndex].Cell).Add(EntryIndex);
+}
+
+void FSpawnerSpatialIndex::RemoveFromCell(int32 EntryIndex)
+{
+	const FIntPoint Cell = entries[EntryIndex].Cell;
+	if (TArray<int32>* CellEntries = cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (CellEntries->Num() == 0)
+		{
+			cells.Remove(Cell);
+		}
+	}
+}
@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/** A point of view spawners should stay out of, usually a player camera */
+struct FSpawnerQueryViewer
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+
+	/** Cosine of half the field of view. Spawners inside the cone are considered in view. */
+	float CosHalfFOV = 0.5f;
+};
+
+/** Parameters of a nearest spawners query */
+struct FSpawnerQuery
+{
+	/** Players (or any point) spawners are measured from. A spawner is in range if it is within the band of at least one viewer. */
+	TArray<FSpawnerQueryViewer> Viewers;
+
+	float MinRange = 0.f;
+	float MaxRange = 5000.f;
+
+	/** Maximum number of spawners returned */
+	int32 MaxResults = 1;
+
+	/** Skip spawners inside the view cone of any viewer */
+	bool bExcludeInView = true;
+};
+
+/**
+ * Uniform grid over the spawner points, used by the wave manager to pick spawners close to the players instead of round-robin.
+ *
+ * Spawners are bucketed by their XY location, so a query only visits the cells overlapping the range band of each viewer
+ * rather than every registered spawner. Spawners are expected to be static; call UpdateLocation if one moves.
+ */
+class CHERRYKNIGHT_API FSpawnerSpatialIndex
+{
+public:
+	explicit FSpawnerSpatialIndex(float InCellSize = 2500.f);
+
+	/** Registers a spawner, enabled. Returns false if it is null or already registered. */
+	bool Add(AActor* Spawner);
+	bool Remove(const AActor* Spawner);
+	void Reset();
+
+	/** Disabled spawners stay in the index but are never returned by queries */
+	bool SetEnabled(const AActor* Spawner, bool bEnabled);
+	bool IsEnabled(const AActor* Spawner) const;
+
+	/** Re-buckets a spawner after it moved */
+	bool UpdateLocation(const AActor* Spawner);
+
+	int32 Num() const { return lookup.Num(); }
+
+	/**
+	 * Appends to OutSpawners up to Query.MaxResults enabled spawners within the range band of any viewer, closest first.
+	 * The distance of a spawner is its distance to the closest viewer.
+	 */
+	void QueryNearest(const FSpawnerQuery& Query, TArray<AActor*>& OutSpawners) const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Spawner;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		bool bEnabled = true;
+		bool bAllocated = false;
+
+		/** Last query that visited this entry, so spawners covered by several viewers are only considered once */
+		mutable uint32 QueryStamp = 0;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+
+	float cellSize;
+	TArray<FEntry> entries;
+	TArray<int32> freeEntries;
+	TMap<FObjectKey, int32> lookup;
+	TMap<FIntPoint, TArray<int32>> cells;
+	mutable uint32 queryStamp = 0;
+};
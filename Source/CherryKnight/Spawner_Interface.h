@@ -24,4 +24,8 @@ class CHERRYKNIGHT_API ISpawner_Interface
 public:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Example")
 	int SpawnEnemy(int maxPoints);
+
+	/** Called when the wave manager spawned an enemy from its wave definition plan at this spawner's location */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Wave Management")
+	void OnPlannedEnemySpawned(AActor* Enemy);
 };
@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WaveDefinition.h"
+#include "Math/RandomStream.h"
+
+FWaveSpawnPlan FWaveSpawnPlan::Compile(const FWaveDefinitionRow& Definition, int32 SpawnTokens, int32 Seed)
+{
+	FWaveSpawnPlan Plan;
+	Plan.SpawnTokens = SpawnTokens;
+	Plan.MaxActiveEnemies = Definition.MaxActiveEnemies;
+	Plan.PercentKillsForNextWave = Definition.PercentKillsForNextWave;
+
+	const int32 NumKinds = Definition.Enemies.Num();
+	TArray<int32> SpawnedPerKind;
+	SpawnedPerKind.SetNumZeroed(NumKinds);
+
+	TArray<int32> Candidates;
+	Candidates.Reserve(NumKinds);
+
+	FRandomStream RandomStream(Seed);
+	int32 RemainingTokens = SpawnTokens;
+
+	while (RemainingTokens > 0)
+	{
+		Candidates.Reset();
+		float TotalWeight = 0.f;
+		for (int32 Kind = 0; Kind < NumKinds; Kind++)
+		{
+			const FWaveEnemyEntry& Enemy = Definition.Enemies[Kind];
+			const bool bUnderCap = Enemy.MaxPerWave <= 0 || SpawnedPerKind[Kind] < Enemy.MaxPerWave;
+			if (!Enemy.EnemyClass.IsNull() && Enemy.Weight > 0.f && FMath::Max(1, Enemy.Cost) <= RemainingTokens && bUnderCap)
+			{
+				Candidates.Add(Kind);
+				TotalWeight += Enemy.Weight;
+			}
+		}
+
+		if (Candidates.Num() == 0)
+		{
+			break;
+		}
+
+		// Weighted pick among the enemies we can still afford
+		float Pick = RandomStream.FRandRange(0.f, TotalWeight);
+		int32 PickedKind = Candidates.Last();
+		for (const int32 Kind : Candidates)
+		{
+			Pick -= Definition.Enemies[Kind].Weight;
+			if (Pick <= 0.f)
+			{
+				PickedKind = Kind;
+				break;
+			}
+		}
+
+		const FWaveEnemyEntry& Enemy = Definition.Enemies[PickedKind];
+		const int32 Cost = FMath::Max(1, Enemy.Cost);
+
+		Plan.Entries.Add({ Enemy.EnemyClass, Cost });
+		Plan.ReferencedClasses.AddUnique(Enemy.EnemyClass);
+		Plan.TotalCost += Cost;
+		SpawnedPerKind[PickedKind]++;
+		RemainingTokens -= Cost;
+	}
+
+	return Plan;
+}
+
+TArray<FWaveDefinitionRow> UWaveDefinitionAsset::GetWaveDefinitions() const
+{
+	if (!WaveTable)
+	{
+		return Waves;
+	}
+
+	TArray<FWaveDefinitionRow> Definitions;
+	WaveTable->ForeachRow<FWaveDefinitionRow>(TEXT("UWaveDefinitionAsset::GetWaveDefinitions"), [&Definitions](const FName& Key, const FWaveDefinitionRow& Row)
+	{
+		Definitions.Add(Row);
+	});
+	return Definitions;
+}
+
+FWaveSpawnPlan UWaveDefinitionAsset::CompileWave(const TArray<FWaveDefinitionRow>& Definitions, int32 WaveIndex) const
+{
+	if (Definitions.Num() == 0)
+	{
+		return FWaveSpawnPlan();
+	}
+
+	const int32 LastIndex = Definitions.Num() - 1;
+	const FWaveDefinitionRow& Definition = Definitions[FMath::Min(WaveIndex, LastIndex)];
+
+	// Same growth as the hand tuned waves get from IncreaseSpawnTokens, one step per extra wave. Computed in double and
+	// clamped, as endless runs would otherwise overflow and compile plans with an unbounded number of entries.
+	const int32 NumExtraWaves = FMath::Max(0, WaveIndex - LastIndex);
+	const double GrownSpawnTokens = Definition.SpawnTokens * FMath::Pow(static_cast<double>(SpawnTokenMultiplier), static_cast<double>(NumExtraWaves));
+	const int32 SpawnTokens = FMath::FloorToInt32(FMath::Min(GrownSpawnTokens, static_cast<double>(FMath::Max(MaxSpawnTokens, Definition.SpawnTokens))));
+
+	return FWaveSpawnPlan::Compile(Definition, SpawnTokens, static_cast<int32>(HashCombine(GetTypeHash(RandomSeed), GetTypeHash(WaveIndex))));
+}
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/DataTable.h"
+#include "WaveDefinition.generated.h"
+
+/** One kind of enemy a wave can spawn */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FWaveEnemyEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management")
+	TSoftClassPtr<AActor> EnemyClass;
+
+	/** Spawn tokens consumed by one enemy of this class. Values below 1 are treated as 1. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 1))
+	int32 Cost = 5;
+
+	/** Relative chance of picking this enemy over the other affordable ones */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 0))
+	float Weight = 1.f;
+
+	/** Maximum number of enemies of this class in the wave. 0 means no cap. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 0))
+	int32 MaxPerWave = 0;
+};
+
+/** Composition of a single wave. Can be authored in a Data Table or directly in a Wave Definition asset. */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FWaveDefinitionRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 1))
+	int32 SpawnTokens = 50;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 1))
+	int32 MaxActiveEnemies = 10;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 0, ClampMax = 1))
+	float PercentKillsForNextWave = 0.75f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management")
+	TArray<FWaveEnemyEntry> Enemies;
+};
+
+/** A single enemy to spawn, in spawn order */
+struct FWaveSpawnPlanEntry
+{
+	TSoftClassPtr<AActor> EnemyClass;
+	int32 Cost = 0;
+};
+
+/** Flat, precomputed list of the enemies a wave spawns, so spawning is a walk over an array rather than a negotiation with the spawners */
+struct CHERRYKNIGHT_API FWaveSpawnPlan
+{
+	int32 SpawnTokens = 0;
+	int32 MaxActiveEnemies = 10;
+	float PercentKillsForNextWave = 0.75f;
+
+	TArray<FWaveSpawnPlanEntry> Entries;
+
+	/** Every distinct enemy class used by Entries, to be preloaded before the wave starts */
+	TArray<TSoftClassPtr<AActor>> ReferencedClasses;
+
+	/** Sum of the cost of every entry, never more than SpawnTokens */
+	int32 TotalCost = 0;
+
+	/**
+	 * Spends the wave tokens on a weighted, deterministic pick of its enemies until nothing affordable is left.
+	 *
+	 * @param Definition	Wave to compile
+	 * @param SpawnTokens	Tokens to spend, usually Definition.SpawnTokens (scaled for waves past the end of the definition)
+	 * @param Seed			Seed of the weighted pick, so the same wave always compiles to the same plan
+	 */
+	static FWaveSpawnPlan Compile(const FWaveDefinitionRow& Definition, int32 SpawnTokens, int32 Seed);
+};
+
+/**
+ * Data driven list of waves for the wave manager.
+ *
+ * Waves past the last definition repeat the last one with its spawn tokens multiplied by SpawnTokenMultiplier for every extra wave.
+ */
+UCLASS(BlueprintType)
+class CHERRYKNIGHT_API UWaveDefinitionAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Optional table of FWaveDefinitionRow, used in row order instead of Waves when set */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (RequiredAssetDataTags = "RowStructure=/Script/CherryKnight.WaveDefinitionRow"))
+	TObjectPtr<UDataTable> WaveTable;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management")
+	TArray<FWaveDefinitionRow> Waves;
+
+	/** Spawn token growth applied for every wave past the last definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 1))
+	float SpawnTokenMultiplier = 1.1f;
+
+	/** Spawn tokens waves past the last definition stop growing at. The last definition keeps its own tokens if it has more. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management", meta = (ClampMin = 1))
+	int32 MaxSpawnTokens = 2000;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Wave Management")
+	int32 RandomSeed = 0;
+
+	/** Returns the wave definitions, from WaveTable if set or Waves otherwise */
+	TArray<FWaveDefinitionRow> GetWaveDefinitions() const;
+
+	/** Compiles the plan of a wave (0 based) from the result of GetWaveDefinitions, extrapolating from the last definition for waves past the end */
+	FWaveSpawnPlan CompileWave(const TArray<FWaveDefinitionRow>& Definitions, int32 WaveIndex) const;
+};
@@ -2,9 +2,184 @@
 
 
 #include "WaveManager_Subsystem.h"
+#include "CherryKnight.h"
 #include "Spawner_Interface.h"
+#include "SpawnerPoint.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Wave"), STAT_WaveManager_SpawnWave, STATGROUP_CherryKnightWaves);
+DECLARE_CYCLE_STAT(TEXT("Spawn Enemies"), STAT_WaveManager_SpawnEnemies, STATGROUP_CherryKnightWaves);
+DECLARE_CYCLE_STAT(TEXT("Process Spawn Requests"), STAT_WaveManager_ProcessSpawnRequests, STATGROUP_CherryKnightWaves);
+DECLARE_CYCLE_STAT(TEXT("Remove Active Enemy"), STAT_WaveManager_RemoveActiveEnemy, STATGROUP_CherryKnightWaves);
+DECLARE_CYCLE_STAT(TEXT("Start Next Wave"), STAT_WaveManager_StartNextWave, STATGROUP_CherryKnightWaves);
+
+static FAutoConsoleCommandWithWorldAndArgs ExportWaveTelemetryCommand(
+	TEXT("CherryKnight.Waves.ExportCsv"),
+	TEXT("Writes the telemetry of the last waves to a CSV file. Usage: CherryKnight.Waves.ExportCsv [FilePath] (defaults to the Profiling directory)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UWaveManager_Subsystem* waveManager = World ? World->GetSubsystem<UWaveManager_Subsystem>() : nullptr;
+		if (!waveManager)
+		{
+			UE_LOG(LogCherryKnightWaves, Warning, TEXT("CherryKnight.Waves.ExportCsv: No wave manager in this world."));
+			return;
+		}
+
+		const FString filePath = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("WaveTelemetry-%s.csv"), *FDateTime::Now().ToString());
+		if (waveManager->ExportWaveTelemetryCsv(filePath))
+		{
+			UE_LOG(LogCherryKnightWaves, Log, TEXT("CherryKnight.Waves.ExportCsv: Wrote wave telemetry to %s"), *filePath);
+		}
+	}));
+
+void UWaveManager_Subsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	enemyPool = NewObject<UEnemyPool>(this);
+}
+
+void UWaveManager_Subsystem::Deinitialize()
+{
+	spawnScheduler.Reset();
+	ResetWaveDefinitionState();
+
+	Super::Deinitialize();
+}
 
 void UWaveManager_Subsystem::SetupAndSpawnFirstWave(int startingSpawnTokens, float spawnTokenMultiplier, float percentKillsForWave, int maxEnemies)
+{
+	waveDefinition = nullptr;
+	waveDefinitionRows.Reset();
+	ResetWaveDefinitionState();
+
+	ResetAndSpawnFirstWave(startingSpawnTokens, spawnTokenMultiplier, percentKillsForWave, maxEnemies);
+}
+
+void UWaveManager_Subsystem::SetupAndSpawnFirstWaveFromDefinition(UWaveDefinitionAsset* WaveDefinition)
+{
+	if (!WaveDefinition)
+	{
+		return;
+	}
+
+	TArray<FWaveDefinitionRow> rows = WaveDefinition->GetWaveDefinitions();
+	if (rows.Num() == 0)
+	{
+		UE_LOG(LogCherryKnightWaves, Warning, TEXT("UWaveManager_Subsystem: Wave definition %s has no waves."), *GetNameSafe(WaveDefinition));
+		return;
+	}
+
+	waveDefinition = WaveDefinition;
+	waveDefinitionRows = MoveTemp(rows);
+	ResetWaveDefinitionState();
+
+	//Starts loading the first wave's enemies while the pools warm up
+	nextWaveClassesHandle = LoadEnemyClasses(GetOrCompilePlan(0).ReferencedClasses);
+
+	const FWaveSpawnPlan& firstPlan = GetOrCompilePlan(0);
+	ResetAndSpawnFirstWave(firstPlan.SpawnTokens, WaveDefinition->SpawnTokenMultiplier, firstPlan.PercentKillsForNextWave, firstPlan.MaxActiveEnemies);
+}
+
+TArray<TSoftClassPtr<AActor>> UWaveManager_Subsystem::GetWaveEnemyClasses(int waveIndex)
+{
+	if (!waveDefinition || waveIndex < 0)
+	{
+		return TArray<TSoftClassPtr<AActor>>();
+	}
+
+	//Only the current and next plans are kept, don't evict them for a wave that isn't about to be played
+	if (compiledPlanWaves[waveIndex % 2] == waveIndex || waveIndex == currentPlanIndex + 1)
+	{
+		return GetOrCompilePlan(waveIndex).ReferencedClasses;
+	}
+
+	return waveDefinition->CompileWave(waveDefinitionRows, waveIndex).ReferencedClasses;
+}
+
+const FWaveSpawnPlan& UWaveManager_Subsystem::GetOrCompilePlan(int waveIndex)
+{
+	//Waves are compiled when they become the current or next wave, replacing the plan from two waves ago
+	const int slot = waveIndex % 2;
+	if (compiledPlanWaves[slot] != waveIndex)
+	{
+		compiledPlans[slot] = waveDefinition->CompileWave(waveDefinitionRows, waveIndex);
+		compiledPlanWaves[slot] = waveIndex;
+	}
+
+	return compiledPlans[slot];
+}
+
+int UWaveManager_Subsystem::CarryOverUnspawnedEntries()
+{
+	TArray<FWaveSpawnPlanEntry> unspawnedEntries;
+
+	//Enemies carried over from an earlier wave are still first in line
+	if (carriedOverCursor < carriedOverEntries.Num())
+	{
+		unspawnedEntries.Append(carriedOverEntries.GetData() + carriedOverCursor, carriedOverEntries.Num() - carriedOverCursor);
+	}
+
+	if (currentPlanIndex != INDEX_NONE)
+	{
+		const FWaveSpawnPlan& plan = GetOrCompilePlan(currentPlanIndex);
+		if (planCursor < plan.Entries.Num())
+		{
+			unspawnedEntries.Append(plan.Entries.GetData() + planCursor, plan.Entries.Num() - planCursor);
+		}
+	}
+
+	carriedOverEntries = MoveTemp(unspawnedEntries);
+	carriedOverCursor = 0;
+
+	int carriedOverTokens = 0;
+	for (const FWaveSpawnPlanEntry& entry : carriedOverEntries)
+	{
+		carriedOverTokens += entry.Cost;
+	}
+	return carriedOverTokens;
+}
+
+TSharedPtr<FStreamableHandle> UWaveManager_Subsystem::LoadEnemyClasses(const TArray<TSoftClassPtr<AActor>>& enemyClasses)
+{
+	//Classes already loaded are requested too, the handle is what keeps them from being garbage collected
+	TArray<FSoftObjectPath> classesToLoad;
+	for (const TSoftClassPtr<AActor>& enemyClass : enemyClasses)
+	{
+		classesToLoad.AddUnique(enemyClass.ToSoftObjectPath());
+	}
+
+	if (classesToLoad.Num() == 0)
+	{
+		return nullptr;
+	}
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(classesToLoad);
+}
+
+void UWaveManager_Subsystem::ResetWaveDefinitionState()
+{
+	for (int slot = 0; slot < 2; slot++)
+	{
+		compiledPlans[slot] = FWaveSpawnPlan();
+		compiledPlanWaves[slot] = INDEX_NONE;
+	}
+	currentPlanIndex = INDEX_NONE;
+	planCursor = 0;
+	carriedOverEntries.Reset();
+	carriedOverCursor = 0;
+
+	//Dropping the handles lets the enemy classes of the previous definition be garbage collected
+	currentWaveClassesHandle.Reset();
+	nextWaveClassesHandle.Reset();
+}
+
+void UWaveManager_Subsystem::ResetAndSpawnFirstWave(int startingSpawnTokens, float spawnTokenMultiplier, float percentKillsForWave, int maxEnemies)
 {
 	waveNumber = 1;
 	totalEnemiesSpawned = 0;
@@ -16,36 +191,261 @@ void UWaveManager_Subsystem::SetupAndSpawnFirstWave(int startingSpawnTokens, flo
 	spawnTokens = startingSpawnTokens;
 	nextWaveSpawnTokenMultiplier = spawnTokenMultiplier;
 	percentKillsForNextWave = percentKillsForWave;
+
+	telemetry.Reset();
+
+	//Pay for enemy construction up front rather than at wave boundaries
+	enemyPool->WarmUp(GetWorld());
+
 	SpawnWave();
 }
 
 void UWaveManager_Subsystem::SpawnWave()
 {
+	SCOPE_CYCLE_COUNTER(STAT_WaveManager_SpawnWave);
+
+	//Close the previous wave's record with its final counts
+	telemetry.UpdateCounts(enemiesSpawnedSinceLastWave, enemiesKilledSinceLastWave);
+
 	enemiesSpawnedSinceLastWave = 0;
 	enemiesKilledSinceLastWave = 0;
-	availableTokens += spawnTokens;
+
+	if (waveDefinition)
+	{
+		//A wave cleared early still owes the enemies it planned, they are spawned before this wave's plan
+		const int carriedOverTokens = CarryOverUnspawnedEntries();
+
+		currentPlanIndex++;
+		planCursor = 0;
+
+		const FWaveSpawnPlan& plan = GetOrCompilePlan(currentPlanIndex);
+		spawnTokens = plan.SpawnTokens;
+		maxActiveEnemies = plan.MaxActiveEnemies;
+		percentKillsForNextWave = plan.PercentKillsForNextWave;
+		availableTokens = plan.TotalCost + carriedOverTokens;
+
+		TArray<TSoftClassPtr<AActor>> waveClasses = plan.ReferencedClasses;
+		for (const FWaveSpawnPlanEntry& entry : carriedOverEntries)
+		{
+			waveClasses.AddUnique(entry.EnemyClass);
+		}
+
+		//New handles are requested before the previous ones are dropped, so classes used by both waves stay loaded.
+		//Get the next wave's enemies loaded while this one is being fought.
+		currentWaveClassesHandle = LoadEnemyClasses(waveClasses);
+		nextWaveClassesHandle = LoadEnemyClasses(GetOrCompilePlan(currentPlanIndex + 1).ReferencedClasses);
+	}
+	else
+	{
+		availableTokens += spawnTokens;
+	}
+
+	//Enemies destroyed without being removed would hold their slot forever
+	activeEnemies.RemoveStale();
 
 	waveNumber++;
 
+	telemetry.BeginWave(waveNumber, spawnTokens, GetWorld()->GetTimeSeconds());
+
 	SpawnEnemies();
 }
 
 void UWaveManager_Subsystem::SpawnEnemies()
 {
-	if (spawnerPoints.Num() > 0)
+	SCOPE_CYCLE_COUNTER(STAT_WaveManager_SpawnEnemies);
+
+	if (spawnerPoints.Num() > 0 && availableTokens > 0)
 	{
-		while ((availableTokens > 0) && (activeEnemies.Num() < maxActiveEnemies))
+		//Only queue enough requests to fill the free slots, the real token cost is only known once the spawner has spawned
+		const int freeSlots = maxActiveEnemies - activeEnemies.Num() - spawnScheduler.Num();
+		if (freeSlots <= 0)
 		{
-			AActor* nextSpawner = spawnerPoints[(totalEnemiesSpawned % spawnerPoints.Num())];
-			if (nextSpawner && nextSpawner->Implements<USpawner_Interface>())
+			return;
+		}
+
+		//Prefer the spawners closest to the players that they can't see
+		FSpawnerQuery query;
+		GatherSpawnerViewers(query.Viewers);
+		query.MinRange = spawnRangeMin;
+		query.MaxRange = spawnRangeMax;
+		query.MaxResults = freeSlots;
+		query.bExcludeInView = bExcludeSpawnersInView;
+
+		TArray<AActor*> nearestSpawners;
+		spawnerIndex.QueryNearest(query, nearestSpawners);
+
+		for (int i = 0; i < freeSlots; i++)
+		{
+			AActor* nextSpawner = nearestSpawners.Num() > 0 ? nearestSpawners[i % nearestSpawners.Num()] : GetNextRoundRobinSpawner();
+			if (!nextSpawner)
 			{
-				int nextEnemyCost = ISpawner_Interface::Execute_SpawnEnemy(nextSpawner, availableTokens);
-				availableTokens -= nextEnemyCost;
-				enemiesSpawnedSinceLastWave++;
-				totalEnemiesSpawned++;
+				break;
 			}
+			spawnScheduler.Enqueue(nextSpawner);
+		}
+	}
+}
+
+void UWaveManager_Subsystem::GatherSpawnerViewers(TArray<FSpawnerQueryViewer>& Viewers) const
+{
+	for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator)
+	{
+		const APlayerController* playerController = iterator->Get();
+		if (!playerController)
+		{
+			continue;
+		}
+
+		FVector viewLocation;
+		FRotator viewRotation;
+		playerController->GetPlayerViewPoint(viewLocation, viewRotation);
+
+		const float fov = playerController->PlayerCameraManager ? playerController->PlayerCameraManager->GetFOVAngle() : 90.f;
+
+		FSpawnerQueryViewer& viewer = Viewers.AddDefaulted_GetRef();
+		viewer.Location = viewLocation;
+		viewer.Direction = viewRotation.Vector();
+		viewer.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(fov * 0.5f));
+	}
+}
+
+AActor* UWaveManager_Subsystem::GetNextRoundRobinSpawner()
+{
+	//Used when there are no players or no spawner in range, skips disabled spawners
+	for (int attempt = 0; attempt < spawnerPoints.Num(); attempt++)
+	{
+		AActor* spawner = spawnerPoints[roundRobinIndex % spawnerPoints.Num()];
+		roundRobinIndex++;
+		if (spawner && spawnerIndex.IsEnabled(spawner))
+		{
+			return spawner;
 		}
 	}
+	return nullptr;
+}
+
+bool UWaveManager_Subsystem::ProcessSpawnRequest(const FWaveSpawnRequest& Request)
+{
+	if ((availableTokens <= 0) || (activeEnemies.Num() >= maxActiveEnemies))
+	{
+		//The wave is done or full, whatever is left in the queue is stale
+		spawnScheduler.Reset();
+		return false;
+	}
+
+	AActor* nextSpawner = Request.Spawner.Get();
+
+	//Spawners using significance activation sleep until they are actually needed
+	if (ASpawnerPoint* spawnerPoint = Cast<ASpawnerPoint>(nextSpawner))
+	{
+		spawnerPoint->WakeUp();
+	}
+
+	if (waveDefinition)
+	{
+		return ProcessPlannedSpawnRequest(nextSpawner);
+	}
+
+	if (nextSpawner && nextSpawner->Implements<USpawner_Interface>())
+	{
+		//Enemies registered by the spawner during this call get associated with it
+		TGuardValue<AActor*> spawnerGuard(currentSpawner, nextSpawner);
+		int nextEnemyCost = ISpawner_Interface::Execute_SpawnEnemy(nextSpawner, availableTokens);
+		if (nextEnemyCost <= 0)
+		{
+			//A free enemy would let the wave spawn forever
+			UE_LOG(LogCherryKnightWaves, Warning, TEXT("UWaveManager_Subsystem: Spawner %s returned an enemy cost of %d, charging 1 token instead."), *GetNameSafe(nextSpawner), nextEnemyCost);
+			spawnScheduler.RecordInvalidCost();
+			nextEnemyCost = 1;
+		}
+		availableTokens -= nextEnemyCost;
+		enemiesSpawnedSinceLastWave++;
+		totalEnemiesSpawned++;
+	}
+
+	return true;
+}
+
+bool UWaveManager_Subsystem::ProcessPlannedSpawnRequest(AActor* Spawner)
+{
+	const FWaveSpawnPlan& plan = GetOrCompilePlan(currentPlanIndex);
+	const bool bCarriedOver = carriedOverCursor < carriedOverEntries.Num();
+	if (!bCarriedOver && planCursor >= plan.Entries.Num())
+	{
+		availableTokens = 0;
+		spawnScheduler.Reset();
+		return false;
+	}
+
+	if (!Spawner)
+	{
+		return true;
+	}
+
+	const FWaveSpawnPlanEntry& entry = bCarriedOver ? carriedOverEntries[carriedOverCursor++] : plan.Entries[planCursor++];
+
+	//Preloading should have done this already, only hitches if the wave started before the async load finished
+	UClass* enemyClass = entry.EnemyClass.Get();
+	if (!enemyClass)
+	{
+		enemyClass = entry.EnemyClass.LoadSynchronous();
+	}
+
+	TGuardValue<AActor*> spawnerGuard(currentSpawner, Spawner);
+	if (AActor* enemy = AcquireEnemy(enemyClass, Spawner->GetActorTransform()))
+	{
+		AddActiveEnemy(enemy);
+		if (Spawner->Implements<USpawner_Interface>())
+		{
+			ISpawner_Interface::Execute_OnPlannedEnemySpawned(Spawner, enemy);
+		}
+	}
+
+	availableTokens -= entry.Cost;
+	enemiesSpawnedSinceLastWave++;
+	totalEnemiesSpawned++;
+	return true;
+}
+
+void UWaveManager_Subsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const int spawnedBefore = totalEnemiesSpawned;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_WaveManager_ProcessSpawnRequests);
+		spawnScheduler.Drain(spawnBudgetMs, maxSpawnsPerFrame, [this](const FWaveSpawnRequest& Request)
+		{
+			return ProcessSpawnRequest(Request);
+		});
+	}
+
+	//Spawners that didn't register their enemy leave slots open, keep filling them while the wave still has tokens
+	if ((spawnScheduler.Num() == 0) && (totalEnemiesSpawned > spawnedBefore))
+	{
+		SpawnEnemies();
+	}
+}
+
+bool UWaveManager_Subsystem::IsTickable() const
+{
+	return spawnScheduler.Num() > 0;
+}
+
+TStatId UWaveManager_Subsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWaveManager_Subsystem, STATGROUP_CherryKnightWaves);
+}
+
+void UWaveManager_Subsystem::SetSpawnBudget(float budgetMs, int maxSpawns)
+{
+	spawnBudgetMs = budgetMs;
+	maxSpawnsPerFrame = maxSpawns;
+}
+
+FWaveSpawnSchedulerStats UWaveManager_Subsystem::GetSpawnSchedulerStats() const
+{
+	return spawnScheduler.GetStats();
 }
 
 void UWaveManager_Subsystem::IncreaseSpawnTokens()
@@ -55,6 +455,8 @@ void UWaveManager_Subsystem::IncreaseSpawnTokens()
 
 void UWaveManager_Subsystem::StartNextWave()
 {
+	SCOPE_CYCLE_COUNTER(STAT_WaveManager_StartNextWave);
+
 	SpawnWave();
 
 	IncreaseSpawnTokens();
@@ -69,25 +471,48 @@ bool UWaveManager_Subsystem::AddSpawnerPoint(AActor* SpawnerPoint)
 {
 	if (SpawnerPoint && SpawnerPoint->Implements<USpawner_Interface>())
 	{
+		if (!spawnerIndex.Add(SpawnerPoint))
+		{
+			return false;
+		}
 		spawnerPoints.Add(SpawnerPoint);
 		return true;
 	}
 	return false;
 }
 
-bool UWaveManager_Subsystem::AddActiveEnemy(AActor* Enemy)
+bool UWaveManager_Subsystem::RemoveSpawnerPoint(AActor* SpawnerPoint)
 {
-	if (activeEnemies.AddUnique(Enemy) == INDEX_NONE)
+	if (!spawnerIndex.Remove(SpawnerPoint))
 	{
 		return false;
 	}
-
+	spawnerPoints.Remove(SpawnerPoint);
 	return true;
 }
 
+bool UWaveManager_Subsystem::SetSpawnerPointEnabled(AActor* SpawnerPoint, bool bEnabled)
+{
+	return spawnerIndex.SetEnabled(SpawnerPoint, bEnabled);
+}
+
+void UWaveManager_Subsystem::SetSpawnRange(float minRange, float maxRange, bool bExcludeInView)
+{
+	spawnRangeMin = minRange;
+	spawnRangeMax = maxRange;
+	bExcludeSpawnersInView = bExcludeInView;
+}
+
+bool UWaveManager_Subsystem::AddActiveEnemy(AActor* Enemy)
+{
+	return activeEnemies.Add(Enemy, currentSpawner).IsValid();
+}
+
 bool UWaveManager_Subsystem::RemoveActiveEnemy(AActor* Enemy)
 {
-	if (activeEnemies.Remove(Enemy) == 0)
+	SCOPE_CYCLE_COUNTER(STAT_WaveManager_RemoveActiveEnemy);
+
+	if (!activeEnemies.Remove(Enemy))
 	{
 		return false;
 	}
@@ -95,10 +520,15 @@ bool UWaveManager_Subsystem::RemoveActiveEnemy(AActor* Enemy)
 	totalEnemiesKilled++;
 	enemiesKilledSinceLastWave++;
 
+	//Recycle the enemy before spawning more so the spawners below can reuse it right away. Enemies the pool doesn't take back
+	//are left to the caller, which destroys them (see IsEnemyPooled) or is already destroying them.
+	enemyPool->Release(Enemy);
+
 	//If percent of enemies killed since last wave is reached, and if there are very few available tokens spawn the next wave, and we aren't already trying to spawn the next wave
 	if ((enemiesKilledSinceLastWave >= (enemiesSpawnedSinceLastWave * percentKillsForNextWave)) && (availableTokens < 10) && !(GetWorld()->GetTimerManager().IsTimerActive(SpawnDelayTimer)))
 	{
 		GetWorld()->GetTimerManager().SetTimer(SpawnDelayTimer, this, &UWaveManager_Subsystem::StartNextWave, 1.0f, false, 1.0f);
+		telemetry.MarkCleared(GetWorld()->GetTimeSeconds());
 	}
 	else if(availableTokens > 0)
 	{
@@ -107,3 +537,63 @@ bool UWaveManager_Subsystem::RemoveActiveEnemy(AActor* Enemy)
 
 	return true;
 }
+
+int UWaveManager_Subsystem::GetActiveEnemyCount() const
+{
+	return activeEnemies.Num();
+}
+
+void UWaveManager_Subsystem::GetActiveEnemiesOfClass(TSubclassOf<AActor> EnemyClass, TArray<AActor*>& Enemies) const
+{
+	Enemies.Reset();
+	activeEnemies.GetEnemiesOfClass(EnemyClass, Enemies);
+}
+
+void UWaveManager_Subsystem::GetActiveEnemiesFromSpawner(AActor* SpawnerPoint, TArray<AActor*>& Enemies) const
+{
+	Enemies.Reset();
+	activeEnemies.GetEnemiesFromSpawner(SpawnerPoint, Enemies);
+}
+
+void UWaveManager_Subsystem::SetEnemyPoolCapacity(TSubclassOf<AActor> EnemyClass, int Capacity)
+{
+	enemyPool->SetCapacity(EnemyClass, Capacity);
+}
+
+AActor* UWaveManager_Subsystem::AcquireEnemy(TSubclassOf<AActor> EnemyClass, FTransform SpawnTransform)
+{
+	return enemyPool->Acquire(GetWorld(), EnemyClass, SpawnTransform);
+}
+
+bool UWaveManager_Subsystem::IsEnemyPooled(AActor* Enemy) const
+{
+	return enemyPool->IsPooled(Enemy);
+}
+
+FEnemyPoolStats UWaveManager_Subsystem::GetEnemyPoolStats(TSubclassOf<AActor> EnemyClass) const
+{
+	return enemyPool->GetStats(EnemyClass);
+}
+
+FEnemyPoolStats UWaveManager_Subsystem::GetTotalEnemyPoolStats() const
+{
+	return enemyPool->GetTotalStats();
+}
+
+TArray<FWaveTelemetryRecord> UWaveManager_Subsystem::GetWaveTelemetry()
+{
+	//The wave in progress only gets its counts when it ends, bring them up to date
+	telemetry.UpdateCounts(enemiesSpawnedSinceLastWave, enemiesKilledSinceLastWave);
+	return telemetry.GetRecords();
+}
+
+bool UWaveManager_Subsystem::ExportWaveTelemetryCsv(const FString& FilePath)
+{
+	telemetry.UpdateCounts(enemiesSpawnedSinceLastWave, enemiesKilledSinceLastWave);
+	if (!FFileHelper::SaveStringToFile(telemetry.ToCsv(), *FilePath))
+	{
+		UE_LOG(LogCherryKnightWaves, Warning, TEXT("UWaveManager_Subsystem: Failed to write wave telemetry to %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
@@ -4,13 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "ActiveEnemyRegistry.h"
+#include "EnemyPool.h"
+#include "SpawnerSpatialIndex.h"
+#include "WaveDefinition.h"
+#include "WaveSpawnScheduler.h"
+#include "WaveTelemetry.h"
 #include "WaveManager_Subsystem.generated.h"
 
 /**
  * 
  */
 UCLASS()
-class CHERRYKNIGHT_API UWaveManager_Subsystem : public UWorldSubsystem
+class CHERRYKNIGHT_API UWaveManager_Subsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 private:
@@ -24,19 +31,86 @@ private:
 	int maxActiveEnemies = 10;
 	float nextWaveSpawnTokenMultiplier = 1.1;
 	float percentKillsForNextWave = 0.75;
+	float spawnBudgetMs = 2.0f;
+	int maxSpawnsPerFrame = 4;
+	float spawnRangeMin = 1000.0f;
+	float spawnRangeMax = 6000.0f;
+	bool bExcludeSpawnersInView = true;
+	int roundRobinIndex = 0;
 	TArray<AActor*> spawnerPoints;
-	TArray<AActor*> activeEnemies;
+	FSpawnerSpatialIndex spawnerIndex;
+	FActiveEnemyRegistry activeEnemies;
+	AActor* currentSpawner = nullptr;
 	FTimerHandle SpawnDelayTimer;
 
+	UPROPERTY()
+	TObjectPtr<UEnemyPool> enemyPool;
+
+	FWaveSpawnScheduler spawnScheduler;
+	FWaveTelemetry telemetry;
+
+	//Set when waves come from a wave definition asset rather than from the scalar settings above
+	UPROPERTY()
+	TObjectPtr<UWaveDefinitionAsset> waveDefinition;
+	TArray<FWaveDefinitionRow> waveDefinitionRows;
+	//Plans of the current and next waves, in slot waveIndex % 2. Plans are deterministic so other waves are compiled again when asked for.
+	FWaveSpawnPlan compiledPlans[2];
+	int compiledPlanWaves[2] = { INDEX_NONE, INDEX_NONE };
+	int currentPlanIndex = INDEX_NONE;
+	int planCursor = 0;
+
+	//Planned enemies a wave cleared early didn't get to spawn, spawned first in the next wave
+	TArray<FWaveSpawnPlanEntry> carriedOverEntries;
+	int carriedOverCursor = 0;
+
+	//Keep the enemy classes of the wave in progress and of the next one loaded, older waves are released
+	TSharedPtr<FStreamableHandle> currentWaveClassesHandle;
+	TSharedPtr<FStreamableHandle> nextWaveClassesHandle;
+
+	void ResetAndSpawnFirstWave(int startingSpawnTokens, float spawnTokenMultiplier, float percentKillsForWave, int maxEnemies);
+	const FWaveSpawnPlan& GetOrCompilePlan(int waveIndex);
+	int CarryOverUnspawnedEntries();
+	TSharedPtr<FStreamableHandle> LoadEnemyClasses(const TArray<TSoftClassPtr<AActor>>& enemyClasses);
+	void ResetWaveDefinitionState();
+	bool ProcessSpawnRequest(const FWaveSpawnRequest& Request);
+	void GatherSpawnerViewers(TArray<FSpawnerQueryViewer>& Viewers) const;
+	AActor* GetNextRoundRobinSpawner();
+	bool ProcessPlannedSpawnRequest(AActor* Spawner);
+
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Setup and Spawn First Wave"), Category = "Wave Management")
 	void SetupAndSpawnFirstWave(int startingSpawnTokens, float spawnTokenMultiplier, float percentKillsForWave, int maxEnemies);
 
+	/**
+	 * Compiles every wave of the definition into a spawn plan, starts preloading the enemy classes of the first waves and spawns the first wave.
+	 * Spawners are then only asked for a location: the enemies come from the plan and spawners get notified through On Planned Enemy Spawned.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Setup and Spawn First Wave From Definition"), Category = "Wave Management")
+	void SetupAndSpawnFirstWaveFromDefinition(UWaveDefinitionAsset* WaveDefinition);
+
+	/** Returns the enemy classes the wave (0 based) of the current wave definition will spawn */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Wave Enemy Classes"), Category = "Wave Management")
+	TArray<TSoftClassPtr<AActor>> GetWaveEnemyClasses(int waveIndex);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Spawn Enemies For Wave"), Category = "Wave Management")
 	void SpawnWave();
 
+	/** Queues spawn requests for every free enemy slot. Requests are spawned over the next frames within the spawn budget. */
 	void SpawnEnemies();
 
+	/** Sets how much time (in milliseconds) and how many enemies can be spent on spawning each frame. Zero or less disables that limit. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Spawn Budget"), Category = "Wave Management")
+	void SetSpawnBudget(float budgetMs, int maxSpawns);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Spawn Scheduler Stats"), Category = "Wave Management")
+	FWaveSpawnSchedulerStats GetSpawnSchedulerStats() const;
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Increase Spawn Tokens"), Category = "Wave Management")
 	void IncreaseSpawnTokens();
 
@@ -46,12 +120,71 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Wave Number"), Category = "Wave Management")
 	int GetWaveNumber();
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Spawn Tokens"), Category = "Wave Management")
+	int GetSpawnTokens() const { return spawnTokens; }
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Available Tokens"), Category = "Wave Management")
+	int GetAvailableTokens() const { return availableTokens; }
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Total Enemies Spawned"), Category = "Wave Management")
+	int GetTotalEnemiesSpawned() const { return totalEnemiesSpawned; }
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Total Enemies Killed"), Category = "Wave Management")
+	int GetTotalEnemiesKilled() const { return totalEnemiesKilled; }
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Spawner Point"), Category = "Wave Management")
 	bool AddSpawnerPoint(AActor* SpawnerPoint);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Remove Spawner Point"), Category = "Wave Management")
+	bool RemoveSpawnerPoint(AActor* SpawnerPoint);
+
+	/** Disabled spawner points are kept registered but never picked to spawn enemies */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Spawner Point Enabled"), Category = "Wave Management")
+	bool SetSpawnerPointEnabled(AActor* SpawnerPoint, bool bEnabled);
+
+	/** Enemies spawn at the closest spawner points between minRange and maxRange of a player, out of the players' view if bExcludeInView. Falls back to round-robin when none qualify. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Spawn Range"), Category = "Wave Management")
+	void SetSpawnRange(float minRange, float maxRange, bool bExcludeInView = true);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Active Enemy"), Category = "Wave Management")
 	bool AddActiveEnemy(AActor* Enemy);
 
+	/** Stops tracking the enemy and returns it to the pool if it has room. Callers destroy the enemy when Is Enemy Pooled returns false afterwards. */
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Remove Active Enemy"), Category = "Wave Management")
 	bool RemoveActiveEnemy(AActor* Enemy);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Enemy Count"), Category = "Wave Management")
+	int GetActiveEnemyCount() const;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Enemies Of Class", DeterminesOutputType = "EnemyClass", DynamicOutputParam = "Enemies"), Category = "Wave Management")
+	void GetActiveEnemiesOfClass(TSubclassOf<AActor> EnemyClass, TArray<AActor*>& Enemies) const;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Active Enemies From Spawner"), Category = "Wave Management")
+	void GetActiveEnemiesFromSpawner(AActor* SpawnerPoint, TArray<AActor*>& Enemies) const;
+
+	/** Sets how many dead enemies of this class are kept deactivated for reuse instead of being destroyed. Pools are filled when the first wave is set up. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Enemy Pool Capacity"), Category = "Wave Management")
+	void SetEnemyPoolCapacity(TSubclassOf<AActor> EnemyClass, int Capacity);
+
+	/** Takes an enemy out of the pool and moves it to SpawnTransform, or spawns a new one if none is available. Spawners should use this instead of Spawn Actor. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Acquire Enemy", DeterminesOutputType = "EnemyClass"), Category = "Wave Management")
+	AActor* AcquireEnemy(TSubclassOf<AActor> EnemyClass, FTransform SpawnTransform);
+
+	/** Returns true if the enemy went back into the pool on removal, in which case it must not be destroyed */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Is Enemy Pooled"), Category = "Wave Management")
+	bool IsEnemyPooled(AActor* Enemy) const;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Enemy Pool Stats"), Category = "Wave Management")
+	FEnemyPoolStats GetEnemyPoolStats(TSubclassOf<AActor> EnemyClass) const;
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Total Enemy Pool Stats"), Category = "Wave Management")
+	FEnemyPoolStats GetTotalEnemyPoolStats() const;
+
+	/** Returns the records of the last waves, oldest first, including the wave in progress */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Wave Telemetry"), Category = "Wave Management")
+	TArray<FWaveTelemetryRecord> GetWaveTelemetry();
+
+	/** Writes the records of the last waves to a CSV file. Also available as the CherryKnight.Waves.ExportCsv console command. */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Export Wave Telemetry CSV"), Category = "Wave Management")
+	bool ExportWaveTelemetryCsv(const FString& FilePath);
 };
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WaveSpawnScheduler.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+void FWaveSpawnScheduler::Enqueue(AActor* Spawner)
+{
+	requests.Add({ Spawner });
+	stats.PeakQueueDepth = FMath::Max(stats.PeakQueueDepth, Num());
+}
+
+void FWaveSpawnScheduler::Reset()
+{
+	requests.Reset();
+	head = 0;
+}
+
+int32 FWaveSpawnScheduler::Drain(float BudgetMs, int32 MaxRequests, TFunctionRef<bool(const FWaveSpawnRequest&)> ProcessRequest)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const double EndTime = StartTime + BudgetMs / 1000.0;
+
+	int32 Processed = 0;
+	while (Num() > 0)
+	{
+		if (Processed > 0 && ((MaxRequests > 0 && Processed >= MaxRequests) || (BudgetMs > 0.f && FPlatformTime::Seconds() >= EndTime)))
+		{
+			stats.BudgetExhaustedFrames++;
+			break;
+		}
+
+		const FWaveSpawnRequest Request = Pop();
+		Processed++;
+
+		if (!ProcessRequest(Request))
+		{
+			break;
+		}
+	}
+
+	stats.RequestsProcessed += Processed;
+	stats.LastFrameSpawnTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	return Processed;
+}
+
+FWaveSpawnSchedulerStats FWaveSpawnScheduler::GetStats() const
+{
+	FWaveSpawnSchedulerStats Result = stats;
+	Result.QueueDepth = Num();
+	return Result;
+}
+
+FWaveSpawnRequest FWaveSpawnScheduler::Pop()
+{
+	const FWaveSpawnRequest Request = requests[head++];
+
+	// Compact once the consumed part dominates the array, keeping pops O(1) amortized
+	if (head == requests.Num())
+	{
+		Reset();
+	}
+	else if (head > 32 && head * 2 > requests.Num())
+	{
+		requests.RemoveAt(0, head, EAllowShrinking::No);
+		head = 0;
+	}
+
+	return Request;
+}
@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "WaveSpawnScheduler.generated.h"
+
+/** Counters for the wave spawn scheduler */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FWaveSpawnSchedulerStats
+{
+	GENERATED_BODY()
+
+	/** Number of spawn requests currently waiting in the queue */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 QueueDepth = 0;
+
+	/** Deepest the queue has ever been */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 PeakQueueDepth = 0;
+
+	/** Number of spawn requests processed since the scheduler was created */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 RequestsProcessed = 0;
+
+	/** Number of frames that stopped draining because the time or count budget ran out with requests left */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 BudgetExhaustedFrames = 0;
+
+	/** Number of spawns that reported a cost of zero or less and were charged the minimum cost instead */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 InvalidCosts = 0;
+
+	/** Time spent spawning during the last drained frame, in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	float LastFrameSpawnTimeMs = 0.f;
+};
+
+/** A single queued request to spawn one enemy from a spawner */
+struct FWaveSpawnRequest
+{
+	TWeakObjectPtr<AActor> Spawner;
+};
+
+/**
+ * FIFO of spawn requests drained against a per-frame time and count budget, so a whole wave isn't spawned in a single frame.
+ *
+ * At least one request is always processed per drain so the queue makes progress even if a single spawn blows the budget.
+ */
+class CHERRYKNIGHT_API FWaveSpawnScheduler
+{
+public:
+	void Enqueue(AActor* Spawner);
+
+	/** Drops every pending request */
+	void Reset();
+
+	int32 Num() const { return requests.Num() - head; }
+
+	/**
+	 * Pops and processes requests until the queue is empty, the budget runs out or ProcessRequest returns false.
+	 *
+	 * @param BudgetMs			Time budget for this frame, in milliseconds. Zero or less means no time limit.
+	 * @param MaxRequests		Maximum number of requests processed this frame. Zero or less means no count limit.
+	 * @param ProcessRequest	Called for every popped request. Return false to stop draining (the request is consumed).
+	 * @return Number of requests processed
+	 */
+	int32 Drain(float BudgetMs, int32 MaxRequests, TFunctionRef<bool(const FWaveSpawnRequest&)> ProcessRequest);
+
+	/** To be called by the processing callback when a spawner reported a cost of zero or less */
+	void RecordInvalidCost() { stats.InvalidCosts++; }
+
+	FWaveSpawnSchedulerStats GetStats() const;
+
+private:
+	FWaveSpawnRequest Pop();
+
+	TArray<FWaveSpawnRequest> requests;
+	int32 head = 0;
+	FWaveSpawnSchedulerStats stats;
+};
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WaveTelemetry.h"
+
+FWaveTelemetry::FWaveTelemetry(int32 InCapacity)
+{
+	records.SetNum(FMath::Max(1, InCapacity));
+}
+
+void FWaveTelemetry::BeginWave(int32 WaveNumber, int32 SpawnTokens, float Time)
+{
+	if (FWaveTelemetryRecord* Current = GetCurrent())
+	{
+		Current->Duration = Time - Current->StartTime;
+	}
+
+	FWaveTelemetryRecord& Record = records[head];
+	Record = FWaveTelemetryRecord();
+	Record.WaveNumber = WaveNumber;
+	Record.SpawnTokens = SpawnTokens;
+	Record.StartTime = Time;
+
+	head = (head + 1) % records.Num();
+	count = FMath::Min(count + 1, records.Num());
+}
+
+void FWaveTelemetry::MarkCleared(float Time)
+{
+	FWaveTelemetryRecord* Current = GetCurrent();
+	if (Current && Current->TimeToClear < 0.f)
+	{
+		Current->TimeToClear = Time - Current->StartTime;
+	}
+}
+
+void FWaveTelemetry::UpdateCounts(int32 EnemiesSpawned, int32 EnemiesKilled)
+{
+	if (FWaveTelemetryRecord* Current = GetCurrent())
+	{
+		Current->EnemiesSpawned = EnemiesSpawned;
+		Current->EnemiesKilled = EnemiesKilled;
+	}
+}
+
+void FWaveTelemetry::Reset()
+{
+	head = 0;
+	count = 0;
+}
+
+TArray<FWaveTelemetryRecord> FWaveTelemetry::GetRecords() const
+{
+	TArray<FWaveTelemetryRecord> Result;
+	Result.Reserve(count);
+
+	const int32 Oldest = (head - count + records.Num()) % records.Num();
+	for (int32 Index = 0; Index < count; Index++)
+	{
+		Result.Add(records[(Oldest + Index) % records.Num()]);
+	}
+	return Result;
+}
+
+FString FWaveTelemetry::ToCsv() const
+{
+	FString Csv = TEXT("WaveNumber,SpawnTokens,EnemiesSpawned,EnemiesKilled,StartTime,Duration,TimeToClear\n");
+	for (const FWaveTelemetryRecord& Record : GetRecords())
+	{
+		Csv += FString::Printf(TEXT("%d,%d,%d,%d,%.3f,%.3f,%.3f\n"),
+			Record.WaveNumber, Record.SpawnTokens, Record.EnemiesSpawned, Record.EnemiesKilled, Record.StartTime, Record.Duration, Record.TimeToClear);
+	}
+	return Csv;
+}
+
+FWaveTelemetryRecord* FWaveTelemetry::GetCurrent()
+{
+	return count > 0 ? &records[(head - 1 + records.Num()) % records.Num()] : nullptr;
+}
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "WaveTelemetry.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("CherryKnight Waves"), STATGROUP_CherryKnightWaves, STATCAT_Advanced);
+
+/** What happened during a single wave */
+USTRUCT(BlueprintType)
+struct CHERRYKNIGHT_API FWaveTelemetryRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 WaveNumber = 0;
+
+	/** Spawn tokens granted to the wave */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 SpawnTokens = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 EnemiesSpawned = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	int32 EnemiesKilled = 0;
+
+	/** World time the wave started at, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	float StartTime = 0.f;
+
+	/** Seconds from the start of this wave to the start of the next one. Negative while the wave is in progress. */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	float Duration = -1.f;
+
+	/** Seconds from the start of the wave until enough enemies were killed to trigger the next one. Negative if not reached. */
+	UPROPERTY(BlueprintReadOnly, Category = "Wave Management")
+	float TimeToClear = -1.f;
+};
+
+/**
+ * Fixed-size ring buffer of the last waves' records. Once full, starting a wave overwrites the oldest record.
+ */
+class CHERRYKNIGHT_API FWaveTelemetry
+{
+public:
+	explicit FWaveTelemetry(int32 InCapacity = 128);
+
+	/** Closes the wave in progress, if any, and opens a record for the new one */
+	void BeginWave(int32 WaveNumber, int32 SpawnTokens, float Time);
+
+	/** Marks the wave in progress as cleared. Only the first call per wave is recorded. */
+	void MarkCleared(float Time);
+
+	/** Updates the spawn and kill counts of the wave in progress */
+	void UpdateCounts(int32 EnemiesSpawned, int32 EnemiesKilled);
+
+	void Reset();
+
+	int32 Num() const { return count; }
+	int32 GetCapacity() const { return records.Num(); }
+
+	/** Returns the records from oldest to newest */
+	TArray<FWaveTelemetryRecord> GetRecords() const;
+
+	/** Writes every record, oldest first, as CSV with a header row */
+	FString ToCsv() const;
+
+private:
+	FWaveTelemetryRecord* GetCurrent();
+
+	TArray<FWaveTelemetryRecord> records;
+
+	/** Index the next record is written at */
+	int32 head = 0;
+	int32 count = 0;
+};
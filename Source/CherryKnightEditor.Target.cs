@@ -10,6 +10,6 @@ public class CherryKnightEditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 
-		ExtraModuleNames.AddRange( new string[] { "CherryKnight" } );
+		ExtraModuleNames.AddRange( new string[] { "CherryKnight", "CherryKnightEditor" } );
 	}
 }
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "EnemyPool.h"
+#include "EnemyPoolTestEnemy.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FEnemyPoolSpec, "CherryKnight.WaveManager.EnemyPool", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	UWorld* World = nullptr;
+	UEnemyPool* Pool = nullptr;
+
+END_DEFINE_SPEC(FEnemyPoolSpec)
+
+void FEnemyPoolSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("EnemyPoolWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		Pool = NewObject<UEnemyPool>(World);
+		Pool->SetCapacity(AEnemyPoolTestEnemy::StaticClass(), 4);
+	});
+
+	AfterEach([this]()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+		Pool = nullptr;
+	});
+
+	It(TEXT("should take back released enemies and hand them out again"), [this]()
+	{
+		AActor* Enemy = Pool->Acquire(World, AEnemyPoolTestEnemy::StaticClass(), FTransform::Identity);
+		TestTrue(TEXT("Released"), Pool->Release(Enemy));
+		TestTrue(TEXT("Pooled"), Pool->IsPooled(Enemy));
+
+		TestTrue(TEXT("Reacquired the same enemy"), Pool->Acquire(World, AEnemyPoolTestEnemy::StaticClass(), FTransform::Identity) == Enemy);
+		TestEqual(TEXT("Hits"), Pool->GetStats(AEnemyPoolTestEnemy::StaticClass()).Hits, 1);
+	});
+
+	It(TEXT("should reject enemies released while they are being destroyed"), [this]()
+	{
+		AEnemyPoolTestEnemy* Enemy = Cast<AEnemyPoolTestEnemy>(Pool->Acquire(World, AEnemyPoolTestEnemy::StaticClass(), FTransform::Identity));
+		if (!TestNotNull(TEXT("Enemy"), Enemy))
+		{
+			return;
+		}
+
+		Enemy->ReleaseOnDestroyed = Pool;
+		Enemy->Destroy();
+
+		const FEnemyPoolStats Stats = Pool->GetStats(AEnemyPoolTestEnemy::StaticClass());
+		TestFalse(TEXT("Released while being destroyed"), Enemy->bReleasedOnDestroyed);
+		TestFalse(TEXT("Pooled"), Pool->IsPooled(Enemy));
+		TestEqual(TEXT("Returns"), Stats.Returns, 0);
+		TestEqual(TEXT("Discards"), Stats.Discards, 0);
+
+		AActor* Next = Pool->Acquire(World, AEnemyPoolTestEnemy::StaticClass(), FTransform::Identity);
+		TestTrue(TEXT("Next enemy is alive"), IsValid(Next) && !Next->IsActorBeingDestroyed());
+		TestTrue(TEXT("Next enemy differs from the destroyed one"), Next != Enemy);
+	});
+}
+
+#endif
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "EnemyPool.h"
+#include "EnemyPoolTestEnemy.generated.h"
+
+/** Enemy releasing itself to a pool when destroyed, like BP_EnemyBaseClass removing itself from Event Destroyed */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown, Transient)
+class AEnemyPoolTestEnemy : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	/** Pool to release the enemy to when destroyed, if any */
+	UPROPERTY()
+	TObjectPtr<UEnemyPool> ReleaseOnDestroyed;
+
+	/** Result of the release done when destroyed */
+	bool bReleasedOnDestroyed = false;
+
+	virtual void Destroyed() override
+	{
+		if (ReleaseOnDestroyed)
+		{
+			bReleasedOnDestroyed = ReleaseOnDestroyed->Release(this);
+		}
+
+		Super::Destroyed();
+	}
+};
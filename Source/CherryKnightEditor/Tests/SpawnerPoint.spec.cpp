@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "SpawnerPoint.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FSpawnerPointSpec, "CherryKnight.WaveManager.SpawnerPoint", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumSpawners = 500;
+	static constexpr int32 NumFrames = 300;
+
+	UWorld* World = nullptr;
+	TArray<ASpawnerPoint*> Spawners;
+
+	void SpawnSpawners(bool bUseSignificanceActivation)
+	{
+		for (int32 Index = 0; Index < NumSpawners; Index++)
+		{
+			const FTransform Transform(FVector(Index * 200.f, 0.f, 0.f));
+			ASpawnerPoint* Spawner = World->SpawnActorDeferred<ASpawnerPoint>(ASpawnerPoint::StaticClass(), Transform);
+			Spawner->bUseSignificanceActivation = bUseSignificanceActivation;
+			Spawner->FinishSpawning(Transform);
+			Spawners.Add(Spawner);
+		}
+	}
+
+	/** Returns the average time of a world tick, in milliseconds */
+	double MeasureWorldTick()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			World->Tick(LEVELTICK_All, 1.f / 60.f);
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+	}
+
+END_DEFINE_SPEC(FSpawnerPointSpec)
+
+void FSpawnerPointSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SpawnerPointWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	});
+
+	AfterEach([this]()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+		Spawners.Reset();
+	});
+
+	It(TEXT("should not register tick functions for 500 spawners"), [this]()
+	{
+		const double EmptyWorldTickMs = MeasureWorldTick();
+
+		SpawnSpawners(false);
+		const double SpawnersWorldTickMs = MeasureWorldTick();
+
+		AddInfo(FString::Printf(TEXT("World tick with %d spawners: %.4f ms (empty world: %.4f ms)"), NumSpawners, SpawnersWorldTickMs, EmptyWorldTickMs));
+
+		int32 NumTicking = 0;
+		for (const ASpawnerPoint* Spawner : Spawners)
+		{
+			NumTicking += Spawner->PrimaryActorTick.IsTickFunctionRegistered() ? 1 : 0;
+		}
+		TestEqual(TEXT("Spawners with a registered tick function"), NumTicking, 0);
+	});
+
+	It(TEXT("should start asleep and wake up on demand with significance activation"), [this]()
+	{
+		SpawnSpawners(true);
+		const double SleepingWorldTickMs = MeasureWorldTick();
+		AddInfo(FString::Printf(TEXT("World tick with %d sleeping spawners: %.4f ms"), NumSpawners, SleepingWorldTickMs));
+
+		for (const ASpawnerPoint* Spawner : Spawners)
+		{
+			if (!TestTrue(TEXT("Spawner asleep after BeginPlay"), Spawner->IsAsleep()))
+			{
+				return;
+			}
+		}
+
+		Spawners[0]->WakeUp();
+		TestFalse(TEXT("Woken spawner awake"), Spawners[0]->IsAsleep());
+		TestTrue(TEXT("Other spawners still asleep"), Spawners[1]->IsAsleep());
+
+		// No player in this world, so the next sleep check puts it back to sleep
+		for (int32 Frame = 0; Frame < FMath::CeilToInt(Spawners[0]->SleepCheckInterval * 60.f) + 1; Frame++)
+		{
+			World->Tick(LEVELTICK_All, 1.f / 60.f);
+		}
+		TestTrue(TEXT("Spawner back asleep without players in range"), Spawners[0]->IsAsleep());
+	});
+}
+
+#endif
@@ -0,0 +1,189 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "SpawnerSpatialIndex.h"
+#include "WaveSimulationSpawner.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FSpawnerSpatialIndexSpec, "CherryKnight.WaveManager.SpawnerSpatialIndex", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 NumSpawners = 1000;
+	static constexpr float WorldExtent = 50000.f;
+
+	UWorld* World = nullptr;
+	TArray<AActor*> Spawners;
+	FSpawnerSpatialIndex Index;
+	FRandomStream RandomStream;
+
+	FSpawnerQuery MakeRandomQuery(int32 NumViewers, int32 MaxResults)
+	{
+		FSpawnerQuery Query;
+		Query.MinRange = 1000.f;
+		Query.MaxRange = 8000.f;
+		Query.MaxResults = MaxResults;
+
+		for (int32 Viewer = 0; Viewer < NumViewers; Viewer++)
+		{
+			FSpawnerQueryViewer& QueryViewer = Query.Viewers.AddDefaulted_GetRef();
+			QueryViewer.Location = FVector(RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent), 0.f);
+			QueryViewer.Direction = FRotator(0.f, RandomStream.FRandRange(0.f, 360.f), 0.f).Vector();
+			QueryViewer.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(45.f));
+		}
+		return Query;
+	}
+
+	/** Reference implementation: scores every spawner */
+	TArray<AActor*> BruteForceQuery(const FSpawnerQuery& Query, const TSet<AActor*>& Disabled) const
+	{
+		TArray<TPair<double, AActor*>> Candidates;
+		for (AActor* Spawner : Spawners)
+		{
+			if (Disabled.Contains(Spawner))
+			{
+				continue;
+			}
+
+			double Closest = TNumericLimits<double>::Max();
+			bool bInView = false;
+			for (const FSpawnerQueryViewer& Viewer : Query.Viewers)
+			{
+				const FVector Delta = Spawner->GetActorLocation() - Viewer.Location;
+				Closest = FMath::Min(Closest, Delta.Size());
+				bInView |= (Delta.GetSafeNormal() | Viewer.Direction) >= Viewer.CosHalfFOV;
+			}
+
+			if (!bInView && Closest >= Query.MinRange && Closest <= Query.MaxRange)
+			{
+				Candidates.Emplace(Closest, Spawner);
+			}
+		}
+
+		Candidates.Sort([](const TPair<double, AActor*>& A, const TPair<double, AActor*>& B) { return A.Key < B.Key; });
+
+		TArray<AActor*> Result;
+		for (int32 Candidate = 0; Candidate < FMath::Min(Query.MaxResults, Candidates.Num()); Candidate++)
+		{
+			Result.Add(Candidates[Candidate].Value);
+		}
+		return Result;
+	}
+
+END_DEFINE_SPEC(FSpawnerSpatialIndexSpec)
+
+void FSpawnerSpatialIndexSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SpawnerSpatialIndexWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		RandomStream.Initialize(1337);
+		Index = FSpawnerSpatialIndex();
+
+		for (int32 Spawner = 0; Spawner < NumSpawners; Spawner++)
+		{
+			const FVector Location(RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent), 0.f);
+			AActor* SpawnerActor = World->SpawnActor<AWaveSimulationSpawner>(Location, FRotator::ZeroRotator);
+			Spawners.Add(SpawnerActor);
+			Index.Add(SpawnerActor);
+		}
+	});
+
+	AfterEach([this]()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+		Spawners.Reset();
+		Index.Reset();
+	});
+
+	It(TEXT("should match a brute force search"), [this]()
+	{
+		for (int32 QueryIndex = 0; QueryIndex < 200; QueryIndex++)
+		{
+			const FSpawnerQuery Query = MakeRandomQuery(1 + QueryIndex % 4, 8);
+
+			TArray<AActor*> Result;
+			Index.QueryNearest(Query, Result);
+
+			if (!TestEqual(TEXT("Query results"), Result, BruteForceQuery(Query, TSet<AActor*>())))
+			{
+				break;
+			}
+		}
+	});
+
+	It(TEXT("should skip disabled spawners"), [this]()
+	{
+		TSet<AActor*> Disabled;
+		for (int32 Spawner = 0; Spawner < NumSpawners; Spawner += 2)
+		{
+			Index.SetEnabled(Spawners[Spawner], false);
+			Disabled.Add(Spawners[Spawner]);
+		}
+
+		for (int32 QueryIndex = 0; QueryIndex < 200; QueryIndex++)
+		{
+			const FSpawnerQuery Query = MakeRandomQuery(2, 8);
+
+			TArray<AActor*> Result;
+			Index.QueryNearest(Query, Result);
+
+			if (!TestEqual(TEXT("Query results"), Result, BruteForceQuery(Query, Disabled)))
+			{
+				break;
+			}
+		}
+	});
+
+	It(TEXT("should report query timings against a brute force search with 1k spawners"), [this]()
+	{
+		constexpr int32 NumQueries = 10000;
+
+		TArray<FSpawnerQuery> Queries;
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			Queries.Add(MakeRandomQuery(4, 10));
+		}
+
+		TArray<TArray<AActor*>> IndexResults;
+		IndexResults.SetNum(NumQueries);
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			Index.QueryNearest(Queries[QueryIndex], IndexResults[QueryIndex]);
+		}
+		const double IndexTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		const TSet<AActor*> Disabled;
+		TArray<TArray<AActor*>> BruteForceResults;
+		BruteForceResults.SetNum(NumQueries);
+		StartTime = FPlatformTime::Seconds();
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			BruteForceResults[QueryIndex] = BruteForceQuery(Queries[QueryIndex], Disabled);
+		}
+		const double BruteForceTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("%d queries over %d spawners: index %.3f ms (%.3f us/query), brute force %.3f ms (%.3f us/query)"),
+			NumQueries, NumSpawners, IndexTimeMs, IndexTimeMs * 1000.0 / NumQueries, BruteForceTimeMs, BruteForceTimeMs * 1000.0 / NumQueries));
+
+		// Wall clock timings depend on the machine, only the results are checked
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			if (!TestEqual(TEXT("Query results"), IndexResults[QueryIndex], BruteForceResults[QueryIndex]))
+			{
+				break;
+			}
+		}
+	});
+}
+
+#endif
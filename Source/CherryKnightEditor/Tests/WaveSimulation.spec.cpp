@@ -0,0 +1,329 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "WaveManager_SubSystem.h"
+#include "WaveSimulationSpawner.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Parameters of a headless wave simulation run */
+struct FWaveSimulationParams
+{
+	int32 NumWaves = 10;
+	int32 NumSpawners = 8;
+	int32 EnemyCost = 5;
+	int32 StartingSpawnTokens = 50;
+	float SpawnTokenMultiplier = 1.1f;
+	float PercentKillsForWave = 0.75f;
+	int32 MaxActiveEnemies = 10;
+	int32 PoolCapacity = 0;
+
+	/** Waves come from this definition instead of the scalar settings above when set */
+	UWaveDefinitionAsset* WaveDefinition = nullptr;
+
+	/** Fraction of the active enemies killed every second */
+	float KillRate = 2.f;
+
+	float DeltaTime = 1.f / 60.f;
+
+	/** Safety net so a pacing regression fails the test instead of hanging it */
+	int32 MaxFrames = 60 * 60 * 10;
+};
+
+/** Per wave measurements of a simulation run */
+struct FWaveSimulationRecord
+{
+	int32 WaveNumber = 0;
+	int32 SpawnTokens = 0;
+	int32 Frames = 0;
+	int32 PeakActiveEnemies = 0;
+	double WallTimeMs = 0.0;
+
+	/** Enemies handed out this wave, either constructed or taken back from the pool */
+	int32 EnemiesSpawned = 0;
+
+	/** Actors constructed by the world this wave, the allocations pooling is meant to avoid */
+	int32 ActorsConstructed = 0;
+
+	/** Enemies served by the pool without constructing a new actor */
+	int32 EnemiesReused = 0;
+};
+
+BEGIN_DEFINE_SPEC(FWaveSimulationSpec, "CherryKnight.WaveManager.Simulation", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	UWorld* World = nullptr;
+	UWaveManager_Subsystem* WaveManager = nullptr;
+	TArray<AWaveSimulationSpawner*> Spawners;
+
+	void CreateWorld(const FWaveSimulationParams& Params)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("WaveSimulationWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		WaveManager = World->GetSubsystem<UWaveManager_Subsystem>();
+
+		for (int32 Index = 0; Index < Params.NumSpawners; Index++)
+		{
+			AWaveSimulationSpawner* Spawner = World->SpawnActor<AWaveSimulationSpawner>(FVector(Index * 500.f, 0.f, 0.f), FRotator::ZeroRotator);
+			Spawner->EnemyCost = Params.EnemyCost;
+			WaveManager->AddSpawnerPoint(Spawner);
+			Spawners.Add(Spawner);
+		}
+
+		if (Params.PoolCapacity > 0)
+		{
+			WaveManager->SetEnemyPoolCapacity(AActor::StaticClass(), Params.PoolCapacity);
+		}
+	}
+
+	void DestroyWorld()
+	{
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		World = nullptr;
+		WaveManager = nullptr;
+		Spawners.Reset();
+	}
+
+	/** Kills enemies at Params.KillRate and ticks the world until NumWaves waves have started. Returns one record per completed wave. */
+	TArray<FWaveSimulationRecord> RunWaves(const FWaveSimulationParams& Params)
+	{
+		TArray<FWaveSimulationRecord> Records;
+
+		if (Params.WaveDefinition)
+		{
+			WaveManager->SetupAndSpawnFirstWaveFromDefinition(Params.WaveDefinition);
+		}
+		else
+		{
+			WaveManager->SetupAndSpawnFirstWave(Params.StartingSpawnTokens, Params.SpawnTokenMultiplier, Params.PercentKillsForWave, Params.MaxActiveEnemies);
+		}
+
+		const int32 LastWave = WaveManager->GetWaveNumber() + Params.NumWaves;
+		float PendingKills = 0.f;
+		TArray<AActor*> ActiveEnemies;
+
+		FWaveSimulationRecord Current;
+		Current.WaveNumber = WaveManager->GetWaveNumber();
+		Current.SpawnTokens = WaveManager->GetSpawnTokens();
+		double WaveStartTime = FPlatformTime::Seconds();
+		int32 WaveStartEnemiesSpawned = WaveManager->GetTotalEnemiesSpawned();
+		int32 WaveStartPoolHits = WaveManager->GetTotalEnemyPoolStats().Hits;
+
+		// Counts actors the world actually constructs, pooled enemies coming back don't go through SpawnActor
+		int32 ActorsConstructed = 0;
+		const FDelegateHandle ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda([&ActorsConstructed](AActor*)
+		{
+			ActorsConstructed++;
+		}));
+
+		for (int32 Frame = 0; Frame < Params.MaxFrames && WaveManager->GetWaveNumber() < LastWave; Frame++)
+		{
+			World->Tick(LEVELTICK_All, Params.DeltaTime);
+
+			WaveManager->GetActiveEnemiesOfClass(AActor::StaticClass(), ActiveEnemies);
+			Current.PeakActiveEnemies = FMath::Max(Current.PeakActiveEnemies, ActiveEnemies.Num());
+			Current.Frames++;
+
+			PendingKills += ActiveEnemies.Num() * Params.KillRate * Params.DeltaTime;
+			for (AActor* Enemy : ActiveEnemies)
+			{
+				if (PendingKills < 1.f)
+				{
+					break;
+				}
+
+				PendingKills -= 1.f;
+				if (WaveManager->RemoveActiveEnemy(Enemy) && !WaveManager->IsEnemyPooled(Enemy))
+				{
+					Enemy->Destroy();
+				}
+			}
+
+			if (WaveManager->GetWaveNumber() != Current.WaveNumber)
+			{
+				Current.WallTimeMs = (FPlatformTime::Seconds() - WaveStartTime) * 1000.0;
+				Current.EnemiesSpawned = WaveManager->GetTotalEnemiesSpawned() - WaveStartEnemiesSpawned;
+				Current.EnemiesReused = WaveManager->GetTotalEnemyPoolStats().Hits - WaveStartPoolHits;
+				Current.ActorsConstructed = ActorsConstructed;
+				Records.Add(Current);
+
+				Current = FWaveSimulationRecord();
+				Current.WaveNumber = WaveManager->GetWaveNumber();
+				Current.SpawnTokens = WaveManager->GetSpawnTokens();
+				WaveStartTime = FPlatformTime::Seconds();
+				WaveStartEnemiesSpawned = WaveManager->GetTotalEnemiesSpawned();
+				WaveStartPoolHits = WaveManager->GetTotalEnemyPoolStats().Hits;
+				ActorsConstructed = 0;
+			}
+		}
+
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		return Records;
+	}
+
+	void ReportRecords(const TArray<FWaveSimulationRecord>& Records, const FWaveSimulationParams& Params)
+	{
+		AddInfo(FString::Printf(TEXT("Token multiplier %.2f, kills for next wave %.2f, max active enemies %d"), Params.SpawnTokenMultiplier, Params.PercentKillsForWave, Params.MaxActiveEnemies));
+		for (const FWaveSimulationRecord& Record : Records)
+		{
+			AddInfo(FString::Printf(TEXT("Wave %d: tokens %d, frames %d, wall time %.3f ms, peak active %d, spawned %d (%d constructed, %d reused)"),
+				Record.WaveNumber, Record.SpawnTokens, Record.Frames, Record.WallTimeMs, Record.PeakActiveEnemies, Record.EnemiesSpawned, Record.ActorsConstructed, Record.EnemiesReused));
+		}
+
+		const FEnemyPoolStats PoolStats = WaveManager->GetTotalEnemyPoolStats();
+		AddInfo(FString::Printf(TEXT("Pool: %d hits, %d misses, %d returns, %d discards, high-water mark %d"),
+			PoolStats.Hits, PoolStats.Misses, PoolStats.Returns, PoolStats.Discards, PoolStats.HighWaterMark));
+	}
+
+END_DEFINE_SPEC(FWaveSimulationSpec)
+
+void FWaveSimulationSpec::Define()
+{
+	Describe(TEXT("Headless waves"), [this]()
+	{
+		AfterEach([this]()
+		{
+			DestroyWorld();
+		});
+
+		It(TEXT("should complete every wave within the frame cap"), [this]()
+		{
+			FWaveSimulationParams Params;
+			CreateWorld(Params);
+
+			const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+			ReportRecords(Records, Params);
+
+			TestEqual(TEXT("Completed waves"), Records.Num(), Params.NumWaves);
+			for (const FWaveSimulationRecord& Record : Records)
+			{
+				TestTrue(TEXT("Peak active enemies within max"), Record.PeakActiveEnemies <= Params.MaxActiveEnemies);
+			}
+		});
+
+		It(TEXT("should grow spawn tokens by the multiplier every wave"), [this]()
+		{
+			FWaveSimulationParams Params;
+			Params.NumWaves = 5;
+			CreateWorld(Params);
+
+			const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+			ReportRecords(Records, Params);
+
+			for (int32 Index = 1; Index < Records.Num(); Index++)
+			{
+				const int32 Expected = FMath::FloorToInt(Records[Index - 1].SpawnTokens * Params.SpawnTokenMultiplier);
+				TestEqual(FString::Printf(TEXT("Spawn tokens of wave %d"), Records[Index].WaveNumber), Records[Index].SpawnTokens, Expected);
+			}
+		});
+
+		It(TEXT("should not spawn forever when spawners report a zero cost"), [this]()
+		{
+			FWaveSimulationParams Params;
+			Params.NumWaves = 2;
+			Params.EnemyCost = 0;
+			CreateWorld(Params);
+
+			const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+			ReportRecords(Records, Params);
+
+			TestEqual(TEXT("Completed waves"), Records.Num(), Params.NumWaves);
+			TestTrue(TEXT("Invalid costs recorded"), WaveManager->GetSpawnSchedulerStats().InvalidCosts > 0);
+		});
+
+		It(TEXT("should reuse pooled enemies across waves"), [this]()
+		{
+			FWaveSimulationParams Params;
+			Params.NumWaves = 5;
+			Params.PoolCapacity = Params.MaxActiveEnemies;
+			CreateWorld(Params);
+
+			const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+			ReportRecords(Records, Params);
+
+			const FEnemyPoolStats PoolStats = WaveManager->GetTotalEnemyPoolStats();
+			TestEqual(TEXT("Completed waves"), Records.Num(), Params.NumWaves);
+			TestEqual(TEXT("Pool misses"), PoolStats.Misses, 0);
+			TestTrue(TEXT("Pool hits"), PoolStats.Hits > 0);
+			for (const FWaveSimulationRecord& Record : Records)
+			{
+				TestEqual(FString::Printf(TEXT("Actors constructed in wave %d"), Record.WaveNumber), Record.ActorsConstructed, 0);
+			}
+		});
+
+		It(TEXT("should carry planned enemies over when a wave is cleared early"), [this]()
+		{
+			FWaveDefinitionRow Wave;
+			Wave.SpawnTokens = 100;
+			Wave.MaxActiveEnemies = 10;
+			Wave.PercentKillsForNextWave = 0.25f;
+
+			FWaveEnemyEntry& Enemy = Wave.Enemies.AddDefaulted_GetRef();
+			Enemy.EnemyClass = AActor::StaticClass();
+			Enemy.Cost = 5;
+
+			UWaveDefinitionAsset* WaveDefinition = NewObject<UWaveDefinitionAsset>();
+			WaveDefinition->Waves.Add(Wave);
+			WaveDefinition->SpawnTokenMultiplier = 1.f;
+
+			FWaveSimulationParams Params;
+			Params.NumWaves = 5;
+			Params.WaveDefinition = WaveDefinition;
+			CreateWorld(Params);
+
+			const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+			ReportRecords(Records, Params);
+
+			// Every started wave planned Wave.SpawnTokens worth of enemies, either spawned or still owed
+			const int32 StartedWaves = WaveManager->GetWaveNumber() - 1;
+			TestEqual(TEXT("Completed waves"), Records.Num(), Params.NumWaves);
+			TestEqual(TEXT("Spawned and owed tokens"), WaveManager->GetTotalEnemiesSpawned() * Enemy.Cost + WaveManager->GetAvailableTokens(), StartedWaves * Wave.SpawnTokens);
+		});
+	});
+
+	Describe(TEXT("Benchmark"), [this]()
+	{
+		AfterEach([this]()
+		{
+			DestroyWorld();
+		});
+
+		for (const int32 MaxActiveEnemies : { 10, 100, 500 })
+		{
+			It(FString::Printf(TEXT("should report wave pacing with %d max active enemies"), MaxActiveEnemies), [this, MaxActiveEnemies]()
+			{
+				FWaveSimulationParams Params;
+				Params.MaxActiveEnemies = MaxActiveEnemies;
+				Params.StartingSpawnTokens = MaxActiveEnemies * Params.EnemyCost * 2;
+				Params.NumSpawners = 32;
+				CreateWorld(Params);
+
+				const double StartTime = FPlatformTime::Seconds();
+				const TArray<FWaveSimulationRecord> Records = RunWaves(Params);
+				AddInfo(FString::Printf(TEXT("Simulated %d waves in %.3f ms"), Records.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0));
+				ReportRecords(Records, Params);
+
+				TestEqual(TEXT("Completed waves"), Records.Num(), Params.NumWaves);
+				for (const FWaveSimulationRecord& Record : Records)
+				{
+					// Every enemy is either a new actor or a pooled one, anything else is an allocation the pool doesn't know about
+					TestEqual(FString::Printf(TEXT("Constructed and reused enemies in wave %d"), Record.WaveNumber), Record.ActorsConstructed + Record.EnemiesReused, Record.EnemiesSpawned);
+				}
+			});
+		}
+	});
+}
+
+#endif
@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WaveSimulationSpawner.h"
+#include "WaveManager_SubSystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+AWaveSimulationSpawner::AWaveSimulationSpawner()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	EnemyClass = AActor::StaticClass();
+}
+
+int AWaveSimulationSpawner::SpawnEnemy_Implementation(int maxPoints)
+{
+	NumSpawnCalls++;
+
+	UWaveManager_Subsystem* WaveManager = GetWorld()->GetSubsystem<UWaveManager_Subsystem>();
+	if (!WaveManager)
+	{
+		return EnemyCost;
+	}
+
+	if (AActor* Enemy = WaveManager->AcquireEnemy(EnemyClass, GetActorTransform()))
+	{
+		WaveManager->AddActiveEnemy(Enemy);
+	}
+
+	return EnemyCost;
+}
+
+void AWaveSimulationSpawner::OnPlannedEnemySpawned_Implementation(AActor* Enemy)
+{
+	NumSpawnCalls++;
+}
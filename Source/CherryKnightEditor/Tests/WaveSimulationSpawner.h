@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Spawner_Interface.h"
+#include "WaveSimulationSpawner.generated.h"
+
+/**
+ * Native stand-in for the Blueprint spawners, used by the headless wave simulation tests.
+ *
+ * Spawns bare actors through the wave manager's enemy pool and reports a fixed cost, so wave pacing can be measured
+ * without any game content.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown, Transient)
+class AWaveSimulationSpawner : public AActor, public ISpawner_Interface
+{
+	GENERATED_BODY()
+
+public:
+	AWaveSimulationSpawner();
+
+	/** Token cost reported for every spawned enemy. Zero or negative costs are allowed to exercise the wave manager guards. */
+	int EnemyCost = 5;
+
+	/** Class of the spawned enemies */
+	TSubclassOf<AActor> EnemyClass;
+
+	/** Number of SpawnEnemy calls received */
+	int NumSpawnCalls = 0;
+
+	virtual int SpawnEnemy_Implementation(int maxPoints) override;
+	virtual void OnPlannedEnemySpawned_Implementation(AActor* Enemy) override;
+};